@@ -194,7 +194,10 @@ const Config::ConfigEntry Config::entries[MAX_CONFIG_KEY] =
 	{TYPE_BOOLEAN,		"IPv6V6Only",				(ConfigValue) false},
 	{TYPE_BOOLEAN,		"WireCompression",			(ConfigValue) false},
 	{TYPE_INTEGER,		"MaxIdentifierByteLength",	(ConfigValue) -1},
-	{TYPE_INTEGER,		"MaxIdentifierCharLength",	(ConfigValue) -1}
+	{TYPE_INTEGER,		"MaxIdentifierCharLength",	(ConfigValue) -1},
+	{TYPE_INTEGER,		"ExtConnPoolSize",			(ConfigValue) 0},
+	{TYPE_INTEGER,		"ExtConnPoolLifeTime",		(ConfigValue) 7200},
+	{TYPE_INTEGER,		"GCThreads",				(ConfigValue) 1}
 };
 
 /******************************************************************************
@@ -643,6 +646,12 @@ const char *Config::getGCPolicy() const
 	return rc;
 }
 
+int Config::getGCThreads() const
+{
+	const int rc = get<int>(KEY_GC_THREADS);
+	return MIN(MAX(rc, 1), MAX_GC_THREADS);
+}
+
 bool Config::getRedirection()
 {
 	return (bool) getDefaultConfig()->values[KEY_REDIRECTION];
@@ -810,3 +819,15 @@ int Config::getMaxIdentifierCharLength() const
 
 	return MIN(MAX(rc, 1), METADATA_IDENTIFIER_CHAR_LEN);
 }
+
+int Config::getExtConnPoolSize()
+{
+	const int rc = (int) getDefaultConfig()->values[KEY_EXT_CONN_POOL_SIZE];
+	return MAX(rc, 0);
+}
+
+int Config::getExtConnPoolLifeTime()
+{
+	const int rc = (int) getDefaultConfig()->values[KEY_EXT_CONN_POOL_LIFETIME];
+	return MAX(rc, 1);
+}
@@ -69,6 +69,8 @@ extern const char*	GCPolicyCooperative;
 extern const char*	GCPolicyBackground;
 extern const char*	GCPolicyCombined;
 
+const int MAX_GC_THREADS = 64;
+
 const int WIRE_CRYPT_DISABLED = 0;
 const int WIRE_CRYPT_ENABLED = 1;
 const int WIRE_CRYPT_REQUIRED = 2;
@@ -142,6 +144,9 @@ public:
 		KEY_WIRE_COMPRESSION,
 		KEY_MAX_IDENTIFIER_BYTE_LENGTH,
 		KEY_MAX_IDENTIFIER_CHAR_LENGTH,
+		KEY_EXT_CONN_POOL_SIZE,
+		KEY_EXT_CONN_POOL_LIFETIME,
+		KEY_GC_THREADS,
 		MAX_CONFIG_KEY		// keep it last
 	};
 
@@ -319,6 +324,9 @@ public:
 	// GC policy
 	const char* getGCPolicy() const;
 
+	// Number of background garbage collector threads
+	int getGCThreads() const;
+
 	// Redirection
 	static bool getRedirection();
 
@@ -349,6 +357,12 @@ public:
 	int getMaxIdentifierByteLength() const;
 
 	int getMaxIdentifierCharLength() const;
+
+	// Maximum number of idle connections kept in external data sources pool
+	static int getExtConnPoolSize();
+
+	// Idle connections lifetime in external data sources pool, seconds
+	static int getExtConnPoolLifeTime();
 };
 
 // Implementation of interface to access master configuration file
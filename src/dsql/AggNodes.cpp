@@ -412,6 +412,24 @@ bool AggNode::aggPass(thread_db* tdbb, jrd_req* request) const
 	return true;
 }
 
+// Remove a record previously passed to aggPass from the aggregation.
+bool AggNode::aggRevert(thread_db* tdbb, jrd_req* request) const
+{
+	fb_assert(canRevert());
+
+	dsc* desc = NULL;
+
+	if (arg)
+	{
+		desc = EVL_expr(tdbb, request, arg);
+		if (request->req_flags & req_null)
+			return false;
+	}
+
+	aggRevert(tdbb, request, desc);
+	return true;
+}
+
 void AggNode::aggFinish(thread_db* /*tdbb*/, jrd_req* request) const
 {
 	if (asb)
@@ -649,6 +667,17 @@ void AvgAggNode::aggPass(thread_db* /*tdbb*/, jrd_req* request, dsc* desc) const
 		ArithmeticNode::add2(desc, impure, this, blr_add);
 }
 
+void AvgAggNode::aggRevert(thread_db* /*tdbb*/, jrd_req* request, dsc* desc) const
+{
+	impure_value_ex* impure = request->getImpure<impure_value_ex>(impureOffset);
+	--impure->vlux_count;
+
+	if (dialect1)
+		ArithmeticNode::add(desc, impure, this, blr_subtract);
+	else
+		ArithmeticNode::add2(desc, impure, this, blr_subtract);
+}
+
 dsc* AvgAggNode::aggExecute(thread_db* tdbb, jrd_req* request) const
 {
 	impure_value_ex* impure = request->getImpure<impure_value_ex>(impureOffset);
@@ -915,6 +944,16 @@ void CountAggNode::aggPass(thread_db* /*tdbb*/, jrd_req* request, dsc* /*desc*/)
 		++impure->vlu_misc.vlu_int64;
 }
 
+void CountAggNode::aggRevert(thread_db* /*tdbb*/, jrd_req* request, dsc* /*desc*/) const
+{
+	impure_value_ex* impure = request->getImpure<impure_value_ex>(impureOffset);
+
+	if (dialect1)
+		--impure->vlu_misc.vlu_long;
+	else
+		--impure->vlu_misc.vlu_int64;
+}
+
 dsc* CountAggNode::aggExecute(thread_db* /*tdbb*/, jrd_req* request) const
 {
 	impure_value_ex* impure = request->getImpure<impure_value_ex>(impureOffset);
@@ -1152,6 +1191,17 @@ void SumAggNode::aggPass(thread_db* /*tdbb*/, jrd_req* request, dsc* desc) const
 		ArithmeticNode::add2(desc, impure, this, blr_add);
 }
 
+void SumAggNode::aggRevert(thread_db* /*tdbb*/, jrd_req* request, dsc* desc) const
+{
+	impure_value_ex* impure = request->getImpure<impure_value_ex>(impureOffset);
+	--impure->vlux_count;
+
+	if (dialect1)
+		ArithmeticNode::add(desc, impure, this, blr_subtract);
+	else
+		ArithmeticNode::add2(desc, impure, this, blr_subtract);
+}
+
 dsc* SumAggNode::aggExecute(thread_db* /*tdbb*/, jrd_req* request) const
 {
 	impure_value_ex* impure = request->getImpure<impure_value_ex>(impureOffset);
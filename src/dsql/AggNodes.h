@@ -52,6 +52,12 @@ public:
 	virtual void aggPass(thread_db* tdbb, jrd_req* request, dsc* desc) const;
 	virtual dsc* aggExecute(thread_db* tdbb, jrd_req* request) const;
 
+	virtual bool canRevert() const
+	{
+		return !distinct && !(nodFlags & FLAG_DOUBLE);
+	}
+	virtual void aggRevert(thread_db* tdbb, jrd_req* request, dsc* desc) const;
+
 protected:
 	virtual AggNode* dsqlCopy(DsqlCompilerScratch* dsqlScratch) /*const*/;
 
@@ -112,6 +118,12 @@ public:
 	virtual void aggPass(thread_db* tdbb, jrd_req* request, dsc* desc) const;
 	virtual dsc* aggExecute(thread_db* tdbb, jrd_req* request) const;
 
+	virtual bool canRevert() const
+	{
+		return !distinct;
+	}
+	virtual void aggRevert(thread_db* tdbb, jrd_req* request, dsc* desc) const;
+
 protected:
 	virtual AggNode* dsqlCopy(DsqlCompilerScratch* dsqlScratch) /*const*/;
 };
@@ -137,6 +149,13 @@ public:
 	virtual void aggPass(thread_db* tdbb, jrd_req* request, dsc* desc) const;
 	virtual dsc* aggExecute(thread_db* tdbb, jrd_req* request) const;
 
+	// Floating point sums are recomputed to not accumulate rounding errors.
+	virtual bool canRevert() const
+	{
+		return !distinct && !(nodFlags & FLAG_DOUBLE);
+	}
+	virtual void aggRevert(thread_db* tdbb, jrd_req* request, dsc* desc) const;
+
 protected:
 	virtual AggNode* dsqlCopy(DsqlCompilerScratch* dsqlScratch) /*const*/;
 };
@@ -1039,6 +1039,19 @@ public:
 	virtual void aggPass(thread_db* tdbb, jrd_req* request, dsc* desc) const = 0;
 	virtual dsc* aggExecute(thread_db* tdbb, jrd_req* request) const = 0;
 
+	// Can records passed to aggPass be removed from the aggregation with aggRevert?
+	virtual bool canRevert() const
+	{
+		return false;
+	}
+
+	bool aggRevert(thread_db* tdbb, jrd_req* request) const;
+
+	virtual void aggRevert(thread_db* /*tdbb*/, jrd_req* /*request*/, dsc* /*desc*/) const
+	{
+		fb_assert(false);
+	}
+
 	virtual AggNode* dsqlPass(DsqlCompilerScratch* dsqlScratch);
 
 protected:
@@ -200,6 +200,9 @@ Jrd::Attachment::Attachment(MemoryPool* pool, Database* dbb)
 	  att_utility(UTIL_NONE),
 	  att_procedures(*pool),
 	  att_functions(*pool),
+	  att_relation_ids(*pool),
+	  att_procedure_ids(*pool),
+	  att_function_ids(*pool),
 	  att_internal(*pool),
 	  att_dyn_req(*pool),
 	  att_charsets(*pool),
@@ -35,6 +35,7 @@
 
 #include "../common/classes/ByteChunk.h"
 #include "../common/classes/GenericMap.h"
+#include "../common/classes/QualifiedName.h"
 #include "../common/classes/SyncObject.h"
 #include "../common/classes/array.h"
 #include "../common/classes/stack.h"
@@ -293,12 +294,26 @@ public:
 
 	/// former Database members - start
 
+	// Metadata below is cached per attachment. Compiled routines and triggers
+	// own their statements, memory pools and existence locks, and their requests
+	// are bound to this attachment, so they cannot be shared between attachments.
+	// Only the routine BLR is shared, see Database::BlrCache.
+
 	vec<jrd_rel*>*					att_relations;			// relation vector
 	Firebird::Array<jrd_prc*>		att_procedures;			// scanned procedures
 	trig_vec*						att_triggers[DB_TRIGGER_MAX];
 	trig_vec*						att_ddl_triggers;
 	Firebird::Array<Function*>		att_functions;			// User defined functions
 
+	// Name to id hints for the vectors above. They are verified on use,
+	// so a stale entry just falls back to the linear search.
+	Firebird::GenericMap<Firebird::Pair<Firebird::Left<
+		Firebird::MetaName, USHORT> > > att_relation_ids;
+	Firebird::GenericMap<Firebird::Pair<Firebird::Left<
+		Firebird::QualifiedName, USHORT> > > att_procedure_ids;
+	Firebird::GenericMap<Firebird::Pair<Firebird::Left<
+		Firebird::QualifiedName, USHORT> > > att_function_ids;
+
 	Firebird::Array<JrdStatement*>	att_internal;			// internal statements
 	Firebird::Array<JrdStatement*>	att_dyn_req;			// internal dyn statements
 	Firebird::ICryptKeyCallback*	att_crypt_callback;		// callback for DB crypt
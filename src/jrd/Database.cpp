@@ -272,6 +272,62 @@ namespace Jrd
 		return result;
 	}
 
+	ULONG Database::BlrCache::getGeneration() const
+	{
+		MutexLockGuard guard(m_mutex, FB_FUNCTION);
+		return m_generation;
+	}
+
+	bool Database::BlrCache::get(const bid& blobId, UCharBuffer& blr) const
+	{
+		MutexLockGuard guard(m_mutex, FB_FUNCTION);
+
+		const UCharBuffer* const cached = m_blrs.get(getKey(blobId));
+
+		if (!cached)
+			return false;
+
+		blr.assign(*cached);
+		return true;
+	}
+
+	void Database::BlrCache::put(const bid& blobId, ULONG generation, const UCharBuffer& blr)
+	{
+		MutexLockGuard guard(m_mutex, FB_FUNCTION);
+
+		// Some blob of a system relation was deleted after this BLR was read,
+		// it could be this very one
+		if (generation != m_generation)
+			return;
+
+		if (m_size + blr.getCount() > MAX_CACHE_SIZE)
+			return;
+
+		UCharBuffer* const cached = m_blrs.put(getKey(blobId));
+
+		if (cached)
+		{
+			cached->assign(blr);
+			m_size += blr.getCount();
+		}
+	}
+
+	void Database::BlrCache::invalidate(const bid& blobId)
+	{
+		MutexLockGuard guard(m_mutex, FB_FUNCTION);
+
+		++m_generation;
+
+		const FB_UINT64 key = getKey(blobId);
+		const UCharBuffer* const cached = m_blrs.get(key);
+
+		if (cached)
+		{
+			m_size -= cached->getCount();
+			m_blrs.remove(key);
+		}
+	}
+
 	void Database::Linger::handler()
 	{
 		JRD_shutdown_database(dbb, SHUT_DBB_RELEASE_POOLS);
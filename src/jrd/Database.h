@@ -274,6 +274,40 @@ public:
 		bool m_localOnly;
 	};
 
+	// Routine BLR read by the attachments of a shared database, keyed by the blob id.
+	// The id of a blob can be reused only after the blob is deleted, so any deletion
+	// of a system relation blob invalidates the whole cache (see blb::delete_blob_id).
+	class BlrCache
+	{
+		static const FB_SIZE_T MAX_CACHE_SIZE = 16 * 1024 * 1024;
+
+		typedef Firebird::GenericMap<Firebird::Pair<Firebird::Right<
+			FB_UINT64, Firebird::UCharBuffer> > > BlrMap;
+
+	public:
+		explicit BlrCache(MemoryPool& p)
+			: m_blrs(p), m_size(0), m_generation(0)
+		{}
+
+		// The generation should be taken before the blob is read and passed to put()
+		ULONG getGeneration() const;
+
+		bool get(const bid& blobId, Firebird::UCharBuffer& blr) const;
+		void put(const bid& blobId, ULONG generation, const Firebird::UCharBuffer& blr);
+		void invalidate(const bid& blobId);
+
+	private:
+		static FB_UINT64 getKey(const bid& blobId)
+		{
+			return ((FB_UINT64) blobId.bid_quad.bid_quad_high << 32) | blobId.bid_quad.bid_quad_low;
+		}
+
+		mutable Firebird::Mutex m_mutex;
+		BlrMap m_blrs;
+		FB_SIZE_T m_size;
+		ULONG m_generation;
+	};
+
 	class ExistenceRefMutex : public Firebird::RefCounted
 	{
 	public:
@@ -441,6 +475,7 @@ public:
 	Firebird::Semaphore dbb_gc_sem;		// Event to wake up garbage collector
 	Firebird::Semaphore dbb_gc_init;	// Event for initialization garbage collector
 	Firebird::Semaphore dbb_gc_fini;	// Event for finalization garbage collector
+	Firebird::Semaphore dbb_gc_workers_fini;	// Event for finalization of garbage collector workers
 
 	Firebird::MemoryStats dbb_memory_stats;
 	RuntimeStatistics dbb_stats;
@@ -464,6 +499,7 @@ public:
 	Firebird::RefPtr<Config> dbb_config;
 
 	SharedCounter dbb_shared_counter;
+	BlrCache dbb_blr_cache;				// routine BLR shared by attachments, see DBB_shared
 	CryptoManager* dbb_crypto_manager;
 	Firebird::RefPtr<ExistenceRefMutex> dbb_init_fini;
 	Firebird::RefPtr<Linger> dbb_linger_timer;
@@ -518,6 +554,7 @@ private:
 		dbb_creation_date(Firebird::TimeStamp::getCurrentTimeStamp()),
 		dbb_external_file_directory_list(NULL),
 		dbb_shared_counter(shared),
+		dbb_blr_cache(*p),
 		dbb_init_fini(FB_NEW_POOL(*getDefaultMemoryPool()) ExistenceRefMutex()),
 		dbb_linger_seconds(0),
 		dbb_linger_end(0),
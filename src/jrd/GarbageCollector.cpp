@@ -132,7 +132,8 @@ PageBitmap* GarbageCollector::getPages(const TraNumber oldest_snapshot, USHORT &
 	}
 
 	FB_SIZE_T pos;
-	if (!m_relations.find(m_nextRelID, pos) && (pos == m_relations.getCount()))
+	const USHORT nextRelID = (USHORT) m_nextRelID.value();
+	if (!m_relations.find(nextRelID, pos) && (pos == m_relations.getCount()))
 		pos = 0;
 
 	for (; pos < m_relations.getCount(); pos++)
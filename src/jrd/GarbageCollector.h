@@ -25,6 +25,7 @@
 
 #include "firebird.h"
 #include "../common/classes/array.h"
+#include "../common/classes/fb_atomic.h"
 #include "../common/classes/GenericMap.h"
 #include "../common/classes/SyncObject.h"
 #include "../jrd/sbm.h"
@@ -118,7 +119,9 @@ private:
 	Firebird::MemoryPool& m_pool;
 	Firebird::SyncObject m_sync;
 	RelGarbageArray m_relations;
-	USHORT m_nextRelID;
+	// Round-robin cursor of getPages(). Several garbage collector threads
+	// move it while holding m_sync in shared mode only.
+	Firebird::AtomicCounter m_nextRelID;
 };
 
 } // namespace Jrd
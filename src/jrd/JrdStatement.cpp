@@ -60,6 +60,7 @@ JrdStatement::JrdStatement(thread_db* tdbb, MemoryPool* p, CompilerScratch* csb)
 	  fors(*p),
 	  invariants(*p),
 	  blr(*p),
+	  explainedPlan(*p),
 	  mapFieldInfo(*p),
 	  mapItemInfo(*p)
 {
@@ -161,6 +162,15 @@ JrdStatement::JrdStatement(thread_db* tdbb, MemoryPool* p, CompilerScratch* csb)
 			// mark the stream as not requiring record's data
 			if (!tail->csb_fields && !(tail->csb_flags & csb_update))
 				 rpb->rpb_stream_flags |= RPB_s_no_data;
+			else if (tail->csb_fields && !(tail->csb_flags & csb_update) &&
+				tail->csb_fields->getLast() && tail->csb_fields->current() <= MAX_USHORT)
+			{
+				// remember the last field referenced, so that the record version
+				// fetched for the stream could be decompressed only up to the end
+				// of this field (see VIO_get and VIO_next_record)
+				rpb->rpb_stream_flags |= RPB_s_partial;
+				rpb->rpb_max_field = (USHORT) tail->csb_fields->current();
+			}
 
 			rpb->rpb_relation = tail->csb_relation;
 
@@ -84,6 +84,7 @@ public:
 	Firebird::Array<ULONG*> invariants;	// pointer to nodes invariant offsets
 	Firebird::RefStrPtr sqlText;		// SQL text (encoded in the metadata charset)
 	Firebird::Array<UCHAR> blr;			// BLR for non-SQL query
+	Firebird::string explainedPlan;		// cached explained plan, see Monitoring::dumpAttachment
 	MapFieldInfo mapFieldInfo;			// Map field name to field info
 	MapItemInfo mapItemInfo;			// Map item to item info
 };
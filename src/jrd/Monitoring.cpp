@@ -1285,17 +1285,22 @@ void Monitoring::dumpAttachment(thread_db* tdbb, Attachment* attachment)
 
 	// Request information
 
-	for (const jrd_req* const* i = attachment->att_requests.begin();
+	for (jrd_req* const* i = attachment->att_requests.begin();
 		 i != attachment->att_requests.end();
 		 ++i)
 	{
-		const jrd_req* const request = *i;
+		jrd_req* const request = *i;
+		JrdStatement* const statement = request->getStatement();
 
-		if (!(request->getStatement()->flags &
-				(JrdStatement::FLAG_INTERNAL | JrdStatement::FLAG_SYS_TRIGGER)))
+		if (!(statement->flags & (JrdStatement::FLAG_INTERNAL | JrdStatement::FLAG_SYS_TRIGGER)))
 		{
-			const string plan = OPT_get_plan(tdbb, request, true);
-			putRequest(record, request, plan);
+			// The plan cannot change after compilation, so build it only once per statement
+			// rather than every time the attachment dumps its state
+
+			if (statement->explainedPlan.isEmpty())
+				statement->explainedPlan = OPT_get_plan(tdbb, request, true);
+
+			putRequest(record, request, statement->explainedPlan);
 		}
 	}
 }
@@ -429,6 +429,70 @@ InversionNode* OptimizerRetrieval::composeInversion(InversionNode* node1, Invers
 	return FB_NEW_POOL(pool) InversionNode(node_type, node1, node2);
 }
 
+void OptimizerRetrieval::estimateSelectivity(IndexScratch* indexScratch) const
+{
+/**************************************
+ *
+ *	e s t i m a t e S e l e c t i v i t y
+ *
+ **************************************
+ *
+ * Functional description
+ *	Stored selectivity is an average for all
+ *	key values and tells nothing about skewed data.
+ *	When a single segment index is matched against
+ *	literals, ask the index which part of its keys
+ *	is within the bounds and keep the selectivity
+ *	inside the estimated limits.
+ *
+ **************************************/
+
+	const index_desc* const idx = indexScratch->idx;
+
+	if (idx->idx_count != 1 || indexScratch->fuzzy)
+		return;
+
+	const IndexScratchSegment* const segment = indexScratch->segments[0];
+
+	switch (segment->scanType)
+	{
+		case segmentScanEqual:
+		case segmentScanEquivalent:
+		case segmentScanBetween:
+		case segmentScanLess:
+		case segmentScanGreater:
+			break;
+
+		default:
+			return;
+	}
+
+	const LiteralNode* const lowerLiteral =
+		segment->lowerValue ? segment->lowerValue->as<LiteralNode>() : NULL;
+	const LiteralNode* const upperLiteral =
+		segment->upperValue ? segment->upperValue->as<LiteralNode>() : NULL;
+
+	if ((segment->lowerValue && !lowerLiteral) || (segment->upperValue && !upperLiteral))
+		return;
+
+	double minSelectivity, maxSelectivity;
+
+	if (!BTR_estimate_range(tdbb, relation, idx,
+			lowerLiteral ? &lowerLiteral->litDesc : NULL,
+			upperLiteral ? &upperLiteral->litDesc : NULL,
+			minSelectivity, maxSelectivity))
+	{
+		return;
+	}
+
+	double& selectivity = indexScratch->selectivity;
+
+	if (selectivity <= 0)
+		selectivity = (minSelectivity + maxSelectivity) / 2;
+	else
+		selectivity = MIN(MAX(selectivity, minSelectivity), maxSelectivity);
+}
+
 const string& OptimizerRetrieval::getAlias()
 {
 /**************************************
@@ -974,6 +1038,9 @@ void OptimizerRetrieval::getInversionCandidates(InversionCandidateList* inversio
 				}
 			}
 
+			if (scratch.scopeCandidate && !unique)
+				estimateSelectivity(&scratch);
+
 			if (scratch.scopeCandidate)
 			{
 				// When selectivity is zero the statement is prepared on an
@@ -2434,7 +2501,7 @@ bool OptimizerRetrieval::validateStarts(IndexScratch* indexScratch, ComparativeB
 
 OptimizerInnerJoin::OptimizerInnerJoin(MemoryPool& p, OptimizerBlk* opt, const StreamList& streams,
 									   SortNode* sort_clause, PlanNode* plan_clause)
-	: pool(p), innerStreams(p)
+	: pool(p), innerStreams(p), streamCosts(p), bestCosts(p)
 {
 /**************************************
  *
@@ -2453,6 +2520,7 @@ OptimizerInnerJoin::OptimizerInnerJoin(MemoryPool& p, OptimizerBlk* opt, const S
 	this->sort = sort_clause;
 	this->plan = plan_clause;
 	this->remainingStreams = 0;
+	this->exhaustive = false;
 
 	innerStreams.grow(streams.getCount());
 	InnerJoinStreamInfo** innerStream = innerStreams.begin();
@@ -2698,6 +2766,13 @@ StreamType OptimizerInnerJoin::findJoinOrder()
 		}
 	}
 
+	// Costs depend on the conjunctions already used by the previously formed
+	// rivers, so don't reuse them between calls
+
+	exhaustive = !plan && innerStreams.getCount() <= MAX_EXHAUSTIVE_JOIN_STREAMS;
+	streamCosts.clear();
+	bestCosts.clear();
+
 	if (optimizer->opt_best_count == 0)
 	{
 		IndexedRelationships indexedRelationships(pool);
@@ -2785,11 +2860,56 @@ void OptimizerInnerJoin::findBestOrder(StreamType position, InnerJoinStreamInfo*
 	// Compute delta and total estimate cost to fetch this stream.
 	double position_cost, position_cardinality, new_cost = 0, new_cardinality = 0;
 
+	bool dominated = false;
+
 	if (!plan)
 	{
-		estimateCost(stream->stream, &position_cost, &position_cardinality, start);
+		if (exhaustive)
+		{
+			// The stream cost depends on the set of streams active before it,
+			// but not on their order. Avoid estimating it again and again.
+
+			const FB_UINT64 key = ((FB_UINT64) getStreamsMask(position - 1) << 32) | stream->stream;
+			const JoinCost* const known = streamCosts.get(key);
+
+			if (known)
+			{
+				position_cost = known->cost;
+				position_cardinality = known->cardinality;
+			}
+			else
+			{
+				estimateCost(stream->stream, &position_cost, &position_cardinality, start);
+
+				JoinCost& streamCost = *streamCosts.put(key);
+				streamCost.cost = position_cost;
+				streamCost.cardinality = position_cardinality;
+			}
+		}
+		else
+			estimateCost(stream->stream, &position_cost, &position_cardinality, start);
+
 		new_cost = cost + cardinality * position_cost;
 		new_cardinality = position_cardinality * cardinality;
+
+		if (exhaustive)
+		{
+			// The rest of the order costs the same for the same set of streams
+			// and grows with the cardinality. So if another order of these
+			// streams was both cheaper and narrower, there's nothing to look for.
+
+			const ULONG mask = getStreamsMask(position);
+			JoinCost* const best = bestCosts.get(mask);
+
+			if (best && best->cost <= new_cost && best->cardinality <= new_cardinality)
+				dominated = true;
+			else if (!best || new_cost < best->cost)
+			{
+				JoinCost& joinCost = best ? *best : *bestCosts.put(mask);
+				joinCost.cost = new_cost;
+				joinCost.cardinality = new_cardinality;
+			}
+		}
 	}
 
 	// If the partial order is either longer than any previous partial order,
@@ -2822,6 +2942,9 @@ void OptimizerInnerJoin::findBestOrder(StreamType position, InnerJoinStreamInfo*
 	if ((optimizer->opt_best_count == remainingStreams) && (optimizer->opt_best_cost < new_cost))
 		done = true;
 
+	if (dominated)
+		done = true;
+
 	if (!done && !plan)
 	{
 		// Add these relations to the processing list
@@ -2864,14 +2987,34 @@ void OptimizerInnerJoin::findBestOrder(StreamType position, InnerJoinStreamInfo*
 			}
 		}
 
-		IndexRelationship** nextRelationship = processList->begin();
-		for (FB_SIZE_T j = 0; j < processList->getCount(); j++)
+		if (exhaustive)
 		{
-			InnerJoinStreamInfo* relationStreamInfo = getStreamInfo(nextRelationship[j]->stream);
-			if (!relationStreamInfo->used)
+			// Try every stream the processing list offers. Each one gets its
+			// own copy of the list, as it's extended on the way down.
+			const IndexedRelationships candidates(pool, *processList);
+			IndexedRelationships nextList(pool);
+
+			for (FB_SIZE_T j = 0; j < candidates.getCount(); j++)
 			{
-				findBestOrder(position, relationStreamInfo, processList, new_cost, new_cardinality);
-				break;
+				InnerJoinStreamInfo* relationStreamInfo = getStreamInfo(candidates[j]->stream);
+				if (!relationStreamInfo->used)
+				{
+					nextList.assign(candidates);
+					findBestOrder(position, relationStreamInfo, &nextList, new_cost, new_cardinality);
+				}
+			}
+		}
+		else
+		{
+			IndexRelationship** nextRelationship = processList->begin();
+			for (FB_SIZE_T j = 0; j < processList->getCount(); j++)
+			{
+				InnerJoinStreamInfo* relationStreamInfo = getStreamInfo(nextRelationship[j]->stream);
+				if (!relationStreamInfo->used)
+				{
+					findBestOrder(position, relationStreamInfo, processList, new_cost, new_cardinality);
+					break;
+				}
 			}
 		}
 	}
@@ -2974,6 +3117,41 @@ InnerJoinStreamInfo* OptimizerInnerJoin::getStreamInfo(StreamType stream)
 	return NULL;
 }
 
+ULONG OptimizerInnerJoin::getStreamsMask(StreamType count) const
+{
+/**************************************
+ *
+ *	g e t S t r e a m s M a s k
+ *
+ **************************************
+ *
+ *  Return the set of the first count streams
+ *  of the current order as a bit mask of
+ *  their positions in innerStreams.
+ *
+ **************************************/
+
+	fb_assert(innerStreams.getCount() <= sizeof(ULONG) * 8);
+
+	ULONG mask = 0;
+
+	for (StreamType i = 0; i < count; i++)
+	{
+		const StreamType stream = optimizer->opt_streams[i].opt_stream_number;
+
+		for (FB_SIZE_T j = 0; j < innerStreams.getCount(); j++)
+		{
+			if (innerStreams[j]->stream == stream)
+			{
+				mask |= (1U << j);
+				break;
+			}
+		}
+	}
+
+	return mask;
+}
+
 #ifdef OPT_DEBUG
 void OptimizerInnerJoin::printBestOrder() const
 {
@@ -38,6 +38,7 @@
 
 #include "../common/classes/alloc.h"
 #include "../common/classes/array.h"
+#include "../common/classes/GenericMap.h"
 #include "../jrd/RecordSourceNodes.h"
 #include "../jrd/rse.h"
 #include "../jrd/exe.h"
@@ -67,6 +68,11 @@ const double THRESHOLD_CARDINALITY = 5.0;
 // so it's not included here.
 const int DEFAULT_INDEX_COST = 3;
 
+// Inner joins of up to that many streams are ordered by exhaustive search
+// through all indexed relationships, larger ones follow the cheapest
+// relationship at every position.
+const FB_SIZE_T MAX_EXHAUSTIVE_JOIN_STREAMS = 10;
+
 
 struct index_desc;
 class OptimizerBlk;
@@ -183,6 +189,7 @@ protected:
 	void analyzeNavigation();
 	InversionNode* composeInversion(InversionNode* node1, InversionNode* node2,
 		InversionNode::Type node_type) const;
+	void estimateSelectivity(IndexScratch* indexScratch) const;
 	const Firebird::string& getAlias();
 	InversionCandidate* generateInversion();
 	void getInversionCandidates(InversionCandidateList* inversions,
@@ -294,6 +301,7 @@ protected:
 		IndexedRelationships* processList, double cost, double cardinality);
 	void getIndexedRelationship(InnerJoinStreamInfo* baseStream, InnerJoinStreamInfo* testStream);
 	InnerJoinStreamInfo* getStreamInfo(StreamType stream);
+	ULONG getStreamsMask(StreamType count) const;
 #ifdef OPT_DEBUG
 	void printBestOrder() const;
 	void printFoundOrder(StreamType position, double positionCost,
@@ -303,6 +311,15 @@ protected:
 #endif
 
 private:
+	struct JoinCost
+	{
+		double cost;
+		double cardinality;
+	};
+
+	typedef Firebird::GenericMap<Firebird::Pair<Firebird::NonPooled<FB_UINT64, JoinCost> > > StreamCostMap;
+	typedef Firebird::GenericMap<Firebird::Pair<Firebird::NonPooled<ULONG, JoinCost> > > JoinCostMap;
+
 	MemoryPool& pool;
 	thread_db* tdbb;
 	SortNode* sort;
@@ -312,6 +329,9 @@ private:
 	OptimizerBlk* optimizer;
 	StreamInfoList innerStreams;
 	StreamType remainingStreams;
+	bool exhaustive;				// try all relationships at every position
+	StreamCostMap streamCosts;		// cost of stream by the set of streams before it
+	JoinCostMap bestCosts;			// cheapest partial order by its set of streams
 };
 
 class StreamStateHolder
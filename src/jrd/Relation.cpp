@@ -525,6 +525,9 @@ void RelationPages::free(RelationPages*& nextFree)
 	if (rel_pages)
 		rel_pages->clear();
 
+	if (rel_leaf_pages)
+		rel_leaf_pages->clear();
+
 	rel_index_root = rel_data_pages = 0;
 	rel_slot_space = rel_pri_data_space = rel_sec_data_space = 0;
 	rel_instance_id = 0;
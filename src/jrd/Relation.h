@@ -66,6 +66,16 @@ typedef Firebird::SortedArray<ViewContext*, Firebird::EmptyStorage<ViewContext*>
 		USHORT, ViewContext> ViewContexts;
 
 
+// Leaf page that received the last key inserted into an index, valid
+// as long as the index tree has the same top page, see BTR_insert
+
+struct LeafHint
+{
+	ULONG lh_root;				// top page of the index tree
+	ULONG lh_leaf;				// leaf page
+};
+
+
 class RelationPages
 {
 public:
@@ -81,12 +91,13 @@ public:
 	ULONG rel_slot_space;		// lowest pointer page with slot space
 	ULONG rel_pri_data_space;	// lowest pointer page with primary data page space
 	ULONG rel_sec_data_space;	// lowest pointer page with secondary data page space
+	vec<LeafHint>* rel_leaf_pages;	// per index: leaf page that received the last inserted key
 	USHORT rel_pg_space_id;
 
 	RelationPages()
 		: rel_pages(NULL), rel_instance_id(0),
 		  rel_index_root(0), rel_data_pages(0), rel_slot_space(0),
-		  rel_pri_data_space(0), rel_sec_data_space(0),
+		  rel_pri_data_space(0), rel_sec_data_space(0), rel_leaf_pages(NULL),
 		  rel_pg_space_id(DB_PAGE_SPACE), rel_next_free(NULL),
 		  useCount(0)
 	{}
@@ -98,6 +109,12 @@ public:
 
 	void free(RelationPages*& nextFree);
 
+	void resetLeafHint(USHORT id)
+	{
+		if (rel_leaf_pages && id < rel_leaf_pages->count())
+			(*rel_leaf_pages)[id] = LeafHint();
+	}
+
 	static inline RP_INSTANCE_ID generate(const RelationPages* item)
 	{
 		return item->rel_instance_id;
@@ -111,16 +111,26 @@ Format* Routine::createFormat(MemoryPool& pool, IMessageMetadata* params, bool a
 void Routine::parseBlr(thread_db* tdbb, CompilerScratch* csb, bid* blob_id)
 {
 	Jrd::Attachment* attachment = tdbb->getAttachment();
+	Database* const dbb = tdbb->getDatabase();
 
 	UCharBuffer tmp;
 
-	if (blob_id)
+	// Attachments of a shared database read the same BLR from the blob once
+
+	const bool shared = (dbb->dbb_flags & DBB_shared);
+
+	if (blob_id && !(shared && dbb->dbb_blr_cache.get(*blob_id, tmp)))
 	{
+		const ULONG generation = shared ? dbb->dbb_blr_cache.getGeneration() : 0;
+
 		blb* blob = blb::open(tdbb, attachment->getSysTransaction(), blob_id);
 		ULONG length = blob->blb_length + 10;
 		UCHAR* temp = tmp.getBuffer(length);
 		length = blob->BLB_get_data(tdbb, temp, length);
 		tmp.resize(length);
+
+		if (shared)
+			dbb->dbb_blr_cache.put(*blob_id, generation, tmp);
 	}
 
 	parseMessages(tdbb, csb, BlrReader(tmp.begin(), (unsigned) tmp.getCount()));
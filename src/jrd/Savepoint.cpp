@@ -20,6 +20,7 @@
 #include "firebird.h"
 #include "../common/gdsassert.h"
 #include "../jrd/tra.h"
+#include "../jrd/sqz.h"
 #include "../jrd/blb_proto.h"
 #include "../jrd/cch_proto.h"
 #include "../jrd/dfw_proto.h"
@@ -35,12 +36,24 @@ using namespace Jrd;
 
 // UndoItem implementation
 
+// Record images are kept in the undo space compressed the same way as on data
+// pages. Large updates could put millions of them there, and most of a typical
+// record image is made of blank or zero filled runs.
+
 UndoItem::UndoItem(jrd_tra* transaction, RecordNumber recordNumber, const Record* record)
 	: m_number(recordNumber.getValue()), m_format(record->getFormat())
 {
 	fb_assert(m_format);
-	m_offset = transaction->getUndoSpace()->allocateSpace(m_format->fmt_length);
-	transaction->getUndoSpace()->write(m_offset, record->getData(), record->getLength());
+
+	const Compressor dcc(*transaction->tra_pool, record->getLength(), record->getData());
+	m_length = dcc.getPackedLength();
+
+	HalfStaticArray<UCHAR, 1024> buffer;
+	UCHAR* const packed = buffer.getBuffer(m_length);
+	dcc.pack(record->getData(), packed);
+
+	m_offset = transaction->getUndoSpace()->allocateSpace(m_length);
+	transaction->getUndoSpace()->write(m_offset, packed, m_length);
 }
 
 Record* UndoItem::setupRecord(jrd_tra* transaction) const
@@ -48,7 +61,17 @@ Record* UndoItem::setupRecord(jrd_tra* transaction) const
 	if (m_format)
 	{
 		Record* const record = transaction->getUndoRecord(m_format);
-		transaction->getUndoSpace()->read(m_offset, record->getData(), record->getLength());
+
+		HalfStaticArray<UCHAR, 1024> buffer;
+		UCHAR* const packed = buffer.getBuffer(m_length);
+		transaction->getUndoSpace()->read(m_offset, packed, m_length);
+
+		const UCHAR* const end = Compressor::unpack(m_length, packed,
+			record->getLength(), record->getData());
+
+		if (end - record->getData() != record->getLength())
+			BUGCHECK(179);	// msg 179 decompression overran buffer
+
 		return record;
 	}
 
@@ -59,7 +82,7 @@ void UndoItem::release(jrd_tra* transaction)
 {
 	if (m_format)
 	{
-		transaction->getUndoSpace()->releaseSpace(m_offset, m_format->fmt_length);
+		transaction->getUndoSpace()->releaseSpace(m_offset, m_length);
 		m_format = NULL;
 	}
 }
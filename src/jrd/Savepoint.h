@@ -40,11 +40,11 @@ namespace Jrd
 		}
 
 		UndoItem()
-			: m_number(0), m_offset(0), m_format(NULL)
+			: m_number(0), m_offset(0), m_length(0), m_format(NULL)
 		{}
 
 		UndoItem(RecordNumber recordNumber)
-			: m_number(recordNumber.getValue()), m_offset(0), m_format(NULL)
+			: m_number(recordNumber.getValue()), m_offset(0), m_length(0), m_format(NULL)
 		{}
 
 		UndoItem(jrd_tra* transaction, RecordNumber recordNumber, const Record* record);
@@ -70,6 +70,7 @@ namespace Jrd
 	private:
 		SINT64 m_number;
 		offset_t m_offset;
+		ULONG m_length;				// length of compressed record image in undo space
 		const Format* m_format;
 	};
 
@@ -264,7 +264,9 @@ private:
 		{
 			inline explicit Scope(const Node* ai)
 				: i(ai),
-				  save(NULL)
+				  save(NULL),
+				  start(NULL),
+				  startPos(NULL)
 			{
 			}
 
@@ -272,10 +274,14 @@ private:
 			{
 				i = ai;
 				save = NULL;
+				start = NULL;
+				startPos = NULL;
 			}
 
 			const Node* i;
 			const CharType* save;
+			const Node* start;			// node and position the scope has started with,
+			const CharType* startPos;	// set when its failure is to be remembered
 		};
 
 		// Stack for recursion emulation.
@@ -367,6 +373,62 @@ private:
 		bool match(int start);
 #else
 		bool match();
+
+		// Limit of (node, position) pairs tracked by the failure memo, see match()
+		static const FB_UINT64 MAX_FAILURE_PAIRS = 8 * 1024 * 1024;
+
+		// Limit of memo bytes logged for clearing, the whole memo is cleared beyond it
+		static const FB_SIZE_T MAX_FAILURE_LOG = 64 * 1024;
+
+		FB_SIZE_T failureIndex(const Node* node, const CharType* pos) const
+		{
+			return (node - nodes.begin()) * (bufferEnd - bufferStart + 1) + (pos - bufferStart);
+		}
+
+		// The memo is kept between match() calls and grown only when a failure is recorded
+		// beyond its end, so bytes not yet allocated are known to be zero. Bytes set by
+		// the previous call are logged and cleared at the start of the next one, so
+		// clearing costs no more than the failures recorded.
+
+		bool isKnownFailure(const Node* node, const CharType* pos) const
+		{
+			const FB_SIZE_T n = failureIndex(node, pos);
+			return (n >> 3) < failures.getCount() && (failures[n >> 3] & (1 << (n & 7))) != 0;
+		}
+
+		void setKnownFailure(const Node* node, const CharType* pos)
+		{
+			const FB_SIZE_T n = failureIndex(node, pos);
+
+			if ((n >> 3) >= failures.getCount())
+				failures.grow((n >> 3) + 1);
+
+			if (!failures[n >> 3] && !failureLogOverflow)
+			{
+				if (failureLog.getCount() < MAX_FAILURE_LOG)
+					failureLog.add(n >> 3);
+				else
+					failureLogOverflow = true;
+			}
+
+			failures[n >> 3] |= (1 << (n & 7));
+		}
+
+		void clearKnownFailures()
+		{
+			if (failureLogOverflow)
+			{
+				memset(failures.begin(), 0, failures.getCount());
+				failureLogOverflow = false;
+			}
+			else
+			{
+				for (const FB_SIZE_T* i = failureLog.begin(); i != failureLog.end(); ++i)
+					failures[*i] = 0;
+			}
+
+			failureLog.clear();
+		}
 #endif
 
 	private:
@@ -394,6 +456,11 @@ private:
 		StrConverter patternCvt;
 		CharSet* charSet;
 		Array<Node> nodes;
+#ifndef RECURSIVE_SIMILAR
+		Array<UCHAR> failures;
+		Array<FB_SIZE_T> failureLog;
+		bool failureLogOverflow;
+#endif
 		const CharType* patternStart;
 		const CharType* patternEnd;
 		const CharType* patternPos;
@@ -486,6 +553,11 @@ SimilarToMatcher<CharType, StrConverter>::Evaluator::Evaluator(
 	  patternCvt(pool, textType, patternStr, patternLen),
 	  charSet(textType->getCharSet()),
 	  nodes(pool),
+#ifndef RECURSIVE_SIMILAR
+	  failures(pool),
+	  failureLog(pool),
+	  failureLogOverflow(false),
+#endif
 	  branchNum(0)
 {
 	fb_assert(patternLen % sizeof(CharType) == 0);
@@ -1392,6 +1464,17 @@ bool SimilarToMatcher<CharType, StrConverter>::Evaluator::match()
 
 	SimpleStack<Scope> scopeStack;
 
+	// Outside of counted repetitions, the outcome of matching the rest of the pattern
+	// from a given node at a given position does not depend on how it was reached.
+	// So the failed (node, position) pairs reached by alternation are remembered
+	// and never evaluated again, which bounds the backtracking by the number of pairs
+	// instead of letting nested alternations and '%' take exponential time.
+
+	const FB_UINT64 pairs = (FB_UINT64) nodes.getCount() * (bufferEnd - bufferStart + 1);
+	const bool memo = (pairs <= MAX_FAILURE_PAIRS);
+
+	clearKnownFailures();
+
 	// Add special node to return without needing additional comparison after popping
 	// the stack on each return.
 	Node nodeRet(opRet);
@@ -1467,7 +1550,21 @@ bool SimilarToMatcher<CharType, StrConverter>::Evaluator::match()
 
 				scope->save = bufferPos;
 
-				scopeStack.push(scope->i + 1);
+				if (memo && repeatStack.getCount() == 0)
+				{
+					if (isKnownFailure(scope->i + 1, bufferPos))
+					{
+						state = msReturningFalse;
+						continue;
+					}
+
+					scopeStack.push(scope->i + 1);
+					scopeStack.back->start = scopeStack.back->i;
+					scopeStack.back->startPos = bufferPos;
+				}
+				else
+					scopeStack.push(scope->i + 1);
+
 				continue;
 
 			case ENCODE_OP_STATE(opBranch, msReturningFalse):
@@ -1483,7 +1580,22 @@ bool SimilarToMatcher<CharType, StrConverter>::Evaluator::match()
 					{
 						scope->save = bufferPos;
 
-						scopeStack.push(scope->i + 1);
+						if (memo && repeatStack.getCount() == 0)
+						{
+							if (isKnownFailure(scope->i + 1, bufferPos))
+							{
+								// try the next alternative
+								state = msReturningFalse;
+								continue;
+							}
+
+							scopeStack.push(scope->i + 1);
+							scopeStack.back->start = scopeStack.back->i;
+							scopeStack.back->startPos = bufferPos;
+						}
+						else
+							scopeStack.push(scope->i + 1);
+
 						continue;
 					}
 				}
@@ -1669,6 +1781,11 @@ bool SimilarToMatcher<CharType, StrConverter>::Evaluator::match()
 				break;
 
 			case msReturningFalse:
+				if (scope->start)
+					setKnownFailure(scope->start, scope->startPos);
+				scopeStack.pop();
+				break;
+
 			case msReturningTrue:
 				scopeStack.pop();
 				break;
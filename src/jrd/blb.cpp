@@ -2260,6 +2260,10 @@ void blb::delete_blob_id(thread_db* tdbb, const bid* blob_id, ULONG prior_page,
 		blob->delete_blob(tdbb, prior_page);
 
 	blob->destroy(true);
+
+	// The blob id may be reused from now on
+	if (relation->isSystem())
+		dbb->dbb_blr_cache.invalidate(*blob_id);
 }
 
 
@@ -187,6 +187,7 @@ namespace
 
 static ULONG add_node(thread_db*, WIN*, index_insertion*, temporary_key*, RecordNumber*,
 					  ULONG*, ULONG*);
+static int compare_keys(const temporary_key*, const temporary_key*);
 static void compress(thread_db*, const dsc*, temporary_key*, USHORT, bool, bool, USHORT);
 static USHORT compress_root(thread_db*, index_root_page*);
 static void copy_key(const temporary_key*, temporary_key*);
@@ -210,18 +211,22 @@ static void generate_jump_nodes(thread_db*, btree_page*, JumpNodeList*, USHORT,
 								USHORT*, USHORT*, USHORT*, USHORT);
 
 static ULONG insert_node(thread_db*, WIN*, index_insertion*, temporary_key*,
-						 RecordNumber*, ULONG*, ULONG*);
+						 RecordNumber*, ULONG*, ULONG*, bool = false);
+static bool insert_leaf_hint(thread_db*, RelationPages*, index_insertion*);
 
 static INT64_KEY make_int64_key(SINT64, SSHORT);
 #ifdef DEBUG_INDEXKEY
 static void print_int64_key(SINT64, SSHORT, INT64_KEY);
 #endif
 static string print_key(thread_db*, jrd_rel*, index_desc*, Record*);
+static const UCHAR* read_jump_node_key(btree_page*, const IndexJumpNode&, IndexNode*,
+									   temporary_key*);
 static contents remove_node(thread_db*, index_insertion*, WIN*);
 static contents remove_leaf_node(thread_db*, index_insertion*, WIN*);
 static bool scan(thread_db*, UCHAR*, RecordBitmap**, RecordBitmap*, index_desc*,
 				 const IndexRetrieval*, USHORT, temporary_key*,
 				 bool&, const temporary_key&);
+static void set_leaf_hint(thread_db*, const index_insertion*, ULONG);
 static void update_selectivity(index_root_page*, USHORT, const SelectivityList&);
 static void checkForLowerKeySkip(bool&, const bool, const IndexNode&, const temporary_key&,
 								 const index_desc&, const IndexRetrieval*);
@@ -539,6 +544,151 @@ bool BTR_description(thread_db* tdbb, jrd_rel* relation, index_root_page* root,
 }
 
 
+bool BTR_estimate_range(thread_db* tdbb, jrd_rel* relation, const index_desc* idx,
+						const dsc* lower, const dsc* upper,
+						double& minFraction, double& maxFraction)
+{
+/**************************************
+ *
+ *	B T R _ e s t i m a t e _ r a n g e
+ *
+ **************************************
+ *
+ * Functional description
+ *	Estimate which part of the keys of an ascending single
+ *	segment index is between given bounds (missing bound is
+ *	unlimited). Nodes of an upper level split the index into
+ *	subtrees of nearly the same size, i.e. the level is an
+ *	equi-depth histogram of the key values. Descend until
+ *	the level has enough nodes or the leaf level is reached.
+ *	Return false if there is nothing to estimate.
+ *
+ **************************************/
+	SET_TDBB(tdbb);
+
+	// Level having less nodes is too coarse, while reading
+	// the level below it costs no more than that many pages
+	const FB_UINT64 MIN_LEVEL_NODES = 32;
+
+	if (idx->idx_count != 1 || (idx->idx_flags & idx_descending))
+		return false;
+
+	const USHORT keyType = (idx->idx_flags & idx_unique) ? INTL_KEY_UNIQUE : INTL_KEY_SORT;
+	const USHORT itype = idx->idx_rpt[0].idx_itype;
+
+	temporary_key lowerKey, upperKey;
+	lowerKey.key_flags = upperKey.key_flags = 0;
+	lowerKey.key_length = upperKey.key_length = 0;
+
+	{	// scope
+		ThreadStatusGuard tempStatus(tdbb);
+
+		try
+		{
+			if (lower)
+				compress(tdbb, lower, &lowerKey, itype, false, false, keyType);
+
+			if (upper)
+				compress(tdbb, upper, &upperKey, itype, false, false, keyType);
+		}
+		catch (const Exception&)
+		{
+			// The bound can't be converted to the key type. Leave
+			// it for the statement execution to report the error.
+			return false;
+		}
+	}
+
+	RelationPages* const relPages = relation->getPages(tdbb);
+	WIN window(relPages->rel_pg_space_id, -1);
+
+	index_root_page* const root = fetch_root(tdbb, &window, relation, relPages);
+	if (!root)
+		return false;
+
+	ULONG page;
+	if (idx->idx_id >= root->irt_count || !(page = root->irt_rpt[idx->idx_id].getRoot()))
+	{
+		CCH_RELEASE(tdbb, &window);
+		return false;
+	}
+
+	btree_page* bucket = (btree_page*) CCH_HANDOFF(tdbb, &window, page, LCK_read, pag_index);
+
+	FB_UINT64 nodes, matched;
+	bool leafLevel;
+	temporary_key key;
+	key.key_flags = 0;
+
+	while (true)
+	{
+		leafLevel = (bucket->btr_level == 0);
+		nodes = matched = 0;
+		ULONG child = 0;
+
+		// walk all pages of the level, count nodes and those within the bounds
+		while (true)
+		{
+			UCHAR* pointer = bucket->btr_nodes + bucket->btr_jump_size;
+			IndexNode node;
+			pointer = node.readNode(pointer, leafLevel);
+
+			if (!leafLevel && !child && !node.isEndBucket && !node.isEndLevel)
+				child = node.pageNumber;
+
+			while (!node.isEndBucket && !node.isEndLevel)
+			{
+				key.key_length = node.prefix + node.length;
+				memcpy(key.key_data + node.prefix, node.data, node.length);
+
+				++nodes;
+
+				if ((!lower || compare_keys(&key, &lowerKey) >= 0) &&
+					(!upper || compare_keys(&key, &upperKey) <= 0))
+				{
+					++matched;
+				}
+
+				pointer = node.readNode(pointer, leafLevel);
+			}
+
+			if (node.isEndLevel || !bucket->btr_sibling)
+				break;
+
+			bucket = (btree_page*) CCH_HANDOFF(tdbb, &window, bucket->btr_sibling, LCK_read, pag_index);
+		}
+
+		if (leafLevel || nodes >= MIN_LEVEL_NODES || !child)
+			break;
+
+		bucket = (btree_page*) CCH_HANDOFF(tdbb, &window, child, LCK_read, pag_index);
+	}
+
+	CCH_RELEASE(tdbb, &window);
+
+	if (!nodes)
+		return false;
+
+	if (leafLevel)
+	{
+		// Leaf nodes are the keys themselves, so the estimation is exact.
+		// Don't report zero, the key could be inserted later.
+		minFraction = (double) matched / nodes;
+		maxFraction = (double) MAX(matched, 1) / nodes;
+	}
+	else
+	{
+		// Node of an upper level is the lowest key of its subtree. All
+		// subtrees started by matched nodes except the last one are within
+		// the bounds, and the range may also overlap the previous subtree.
+		minFraction = (double) (matched > 1 ? matched - 1 : 0) / nodes;
+		maxFraction = (double) MIN(matched + 1, nodes) / nodes;
+	}
+
+	return true;
+}
+
+
 DSC* BTR_eval_expression(thread_db* tdbb, index_desc* idx, Record* record, bool& notNull)
 {
 	SET_TDBB(tdbb);
@@ -1000,6 +1150,16 @@ void BTR_insert(thread_db* tdbb, WIN* root_window, index_insertion* insertion)
 
 	index_desc* idx = insertion->iib_descriptor;
 	RelationPages* relPages = insertion->iib_relation->getPages(tdbb);
+
+	// Keys of a mass insert usually come in (nearly) ascending order, so try
+	// the leaf page that received the previous key first and avoid the
+	// descent from the top of the tree for each record.
+	if (insert_leaf_hint(tdbb, relPages, insertion))
+	{
+		CCH_RELEASE(tdbb, root_window);
+		return;
+	}
+
 	WIN window(relPages->rel_pg_space_id, idx->idx_root);
 	btree_page* bucket = (btree_page*) CCH_FETCH(tdbb, &window, LCK_read, pag_index);
 	UCHAR root_level = bucket->btr_level;
@@ -1751,7 +1911,10 @@ bool BTR_next_index(thread_db* tdbb, jrd_rel* relation, jrd_tra* transaction, in
 				irt_desc = root->irt_rpt + id;
 
 				if (irt_desc->getTransaction() == trans)
+				{
 					BTR_delete_index(tdbb, window, id);
+					relation->getPages(tdbb, transaction->tra_number)->resetLeafHint(id);
+				}
 				else
 					CCH_RELEASE(tdbb, window);
 
@@ -2267,7 +2430,12 @@ static ULONG add_node(thread_db* tdbb,
 				new_record_number, original_page, sibling_page);
 
 			if (split != NO_VALUE_PAGE)
+			{
+				if (split == NO_SPLIT && insertion->iib_btr_level == 0)
+					set_leaf_hint(tdbb, insertion, window->win_page.getPageNum());
+
 				return split;
+			}
 
 			bucket = (btree_page*) CCH_HANDOFF(tdbb, window, bucket->btr_sibling, LCK_write, pag_index);
 		}
@@ -2365,6 +2533,29 @@ static ULONG add_node(thread_db* tdbb,
 }
 
 
+static int compare_keys(const temporary_key* key1, const temporary_key* key2)
+{
+/**************************************
+ *
+ *	c o m p a r e _ k e y s
+ *
+ **************************************
+ *
+ * Functional description
+ *	Compare two keys byte-wise, shorter key
+ *	is less than the longer one it's prefix of.
+ *
+ **************************************/
+	const USHORT length = MIN(key1->key_length, key2->key_length);
+	const int result = memcmp(key1->key_data, key2->key_data, length);
+
+	if (result)
+		return result;
+
+	return (int) key1->key_length - (int) key2->key_length;
+}
+
+
 static void compress(thread_db* tdbb,
 					 const dsc* desc,
 					 temporary_key* key,
@@ -4198,23 +4389,32 @@ static UCHAR* find_area_start_point(btree_page* bucket, const temporary_key* key
 		IndexJumpNode jumpNode;
 		pointer = jumpNode.readJumpNode(pointer);
 
-		IndexNode node;
-		node.readNode((UCHAR*) bucket + jumpNode.offset, leafPage);
-
-		// jumpKey will hold complete data off referenced node
+		// jumpKey holds the prefix of the referenced node stored in the jump
+		// nodes. The next jump node never refers to data beyond this prefix,
+		// so the referenced node itself is read (and appended to jumpKey) only
+		// when the key matches the whole prefix. Most jump nodes are decided
+		// without touching the node area of the page at all.
 		memcpy(jumpKey.key_data + jumpNode.prefix, jumpNode.data, jumpNode.length);
-		memcpy(jumpKey.key_data + node.prefix, node.data, node.length);
-		jumpKey.key_length = node.prefix + node.length;
+		jumpKey.key_length = jumpNode.prefix + jumpNode.length;
+
+		IndexNode node;
+		bool nodeRead = false;
 
 		keyPointer = key->key_data + jumpNode.prefix;
 		const UCHAR* q = jumpKey.key_data + jumpNode.prefix;
-		const UCHAR* const nodeEnd = jumpKey.key_data + jumpKey.key_length;
+		const UCHAR* nodeEnd = jumpKey.key_data + jumpKey.key_length;
 		bool done = false;
 
 		if ((jumpNode.prefix <= testPrefix) && descending)
 		{
 			while (true)
 			{
+				if (q == nodeEnd && !nodeRead)
+				{
+					nodeEnd = read_jump_node_key(bucket, jumpNode, &node, &jumpKey);
+					nodeRead = true;
+				}
+
 				if (q == nodeEnd)
 				{
 					done = true;
@@ -4284,6 +4484,12 @@ static UCHAR* find_area_start_point(btree_page* bucket, const temporary_key* key
 		{
 			while (true)
 			{
+				if (q == nodeEnd && !nodeRead)
+				{
+					nodeEnd = read_jump_node_key(bucket, jumpNode, &node, &jumpKey);
+					nodeRead = true;
+				}
+
 				if (keyPointer == keyEnd)
 				{
 					// Reached end of our key we're searching for.
@@ -5198,7 +5404,8 @@ static ULONG insert_node(thread_db* tdbb,
 						 temporary_key* new_key,
 						 RecordNumber* new_record_number,
 						 ULONG* original_page,
-						 ULONG* sibling_page)
+						 ULONG* sibling_page,
+						 bool hinted)
 {
 /**************************************
  *
@@ -5212,6 +5419,11 @@ static ULONG insert_node(thread_db* tdbb,
  *  If it splits, return the split page number and
  *	leading string.  This is the workhorse for add_node.
  *
+ *	If the page was not reached by a descent from the top of
+ *	the tree (hinted), the key must also sort after the first
+ *	node of the page and the page must not split, otherwise
+ *	NO_VALUE is returned as well and nothing is changed.
+ *
  **************************************/
 
 	SET_TDBB(tdbb);
@@ -5243,6 +5455,11 @@ static ULONG insert_node(thread_db* tdbb,
 	if (!pointer)
 		return NO_VALUE_PAGE;
 
+	// Without the parent page we can't tell whether a key which sorts before
+	// the first node belongs to this page or to its left sibling.
+	if (hinted && pointer == bucket->btr_nodes + bucket->btr_jump_size)
+		return NO_VALUE_PAGE;
+
 	if ((UCHAR*) pointer - (UCHAR*) bucket > dbb->dbb_page_size)
 		BUGCHECK(205);	// msg 205 index bucket overfilled
 
@@ -5518,6 +5735,21 @@ static ULONG insert_node(thread_db* tdbb,
 		return NO_SPLIT;
 	}
 
+	// A split has to be propagated to the parent page which we don't know.
+	if (hinted)
+	{
+		if (fragmentedOffset)
+		{
+			IndexJumpNode* walkJumpNode = jumpNodes->begin();
+			for (size_t i = 0; i < jumpNodes->getCount(); i++)
+				delete[] walkJumpNode[i].data;
+		}
+
+		jumpNodes->clear();
+
+		return NO_VALUE_PAGE;
+	}
+
 	// We've a bucket split in progress.  We need to determine the split point.
 	// Set it halfway through the page, unless we are at the end of the page,
 	// in which case put only the new node on the new page.  This will ensure
@@ -5818,6 +6050,66 @@ static ULONG insert_node(thread_db* tdbb,
 }
 
 
+static bool insert_leaf_hint(thread_db* tdbb, RelationPages* relPages, index_insertion* insertion)
+{
+/**************************************
+ *
+ *	i n s e r t _ l e a f _ h i n t
+ *
+ **************************************
+ *
+ * Functional description
+ *	Try to insert a node into the leaf page that received
+ *	the previous key of the index.  Return false if the index
+ *	tree was rebuilt since, the page is busy, no longer a leaf
+ *	of this index, the key belongs to another page or the page
+ *	would split.  The caller then inserts the node the usual way.
+ *
+ **************************************/
+	const index_desc* const idx = insertion->iib_descriptor;
+	const vec<LeafHint>* const hints = relPages->rel_leaf_pages;
+
+	if (insertion->iib_btr_level || !hints || idx->idx_id >= hints->count())
+		return false;
+
+	const LeafHint& hint = (*hints)[idx->idx_id];
+
+	// Pages of a deleted index tree are released without being changed,
+	// so a hint is trusted only while the tree has the same top page
+	if (!hint.lh_leaf || hint.lh_root != idx->idx_root)
+		return false;
+
+	// Don't wait for the latch: the index root page is still held by the caller
+	WIN window(relPages->rel_pg_space_id, hint.lh_leaf);
+	const btree_page* const bucket =
+		(btree_page*) CCH_FETCH_TIMEOUT(tdbb, &window, LCK_write, pag_undefined, 0);
+
+	if (!bucket)
+		return false;
+
+	if (bucket->btr_header.pag_type != pag_index ||
+		(bucket->btr_header.pag_flags & btr_released) ||
+		bucket->btr_relation != insertion->iib_relation->rel_id ||
+		bucket->btr_id != (UCHAR) idx->idx_id || bucket->btr_level != 0)
+	{
+		CCH_RELEASE(tdbb, &window);
+		return false;
+	}
+
+	// The split key is not used as the page is never split here
+	temporary_key key;
+	key.key_flags = 0;
+	key.key_length = 0;
+	RecordNumber recordNumber(0);
+
+	if (insert_node(tdbb, &window, insertion, &key, &recordNumber, NULL, NULL, true) == NO_SPLIT)
+		return true;
+
+	CCH_RELEASE(tdbb, &window);
+	return false;
+}
+
+
 static INT64_KEY make_int64_key(SINT64 q, SSHORT scale)
 {
 /**************************************
@@ -6024,6 +6316,30 @@ string print_key(thread_db* tdbb, jrd_rel* relation, index_desc* idx, Record* re
 }
 
 
+static const UCHAR* read_jump_node_key(btree_page* bucket, const IndexJumpNode& jumpNode,
+									   IndexNode* node, temporary_key* jumpKey)
+{
+/**************************************
+ *
+ *	r e a d _ j u m p _ n o d e _ k e y
+ *
+ **************************************
+ *
+ * Functional description
+ *	Read the node referenced by a jump node and complete
+ *	the jump key, which already holds the node prefix,
+ *	with the node data.  Return the end of the key.
+ *
+ **************************************/
+	node->readNode((UCHAR*) bucket + jumpNode.offset, bucket->btr_level == 0);
+
+	memcpy(jumpKey->key_data + node->prefix, node->data, node->length);
+	jumpKey->key_length = node->prefix + node->length;
+
+	return jumpKey->key_data + jumpKey->key_length;
+}
+
+
 static contents remove_node(thread_db* tdbb, index_insertion* insertion, WIN* window)
 {
 /**************************************
@@ -6433,6 +6749,43 @@ static bool scan(thread_db* tdbb, UCHAR* pointer, RecordBitmap** bitmap, RecordB
 }
 
 
+static void set_leaf_hint(thread_db* tdbb, const index_insertion* insertion, ULONG page)
+{
+/**************************************
+ *
+ *	s e t _ l e a f _ h i n t
+ *
+ **************************************
+ *
+ * Functional description
+ *	Remember the leaf page a key was inserted into,
+ *	see insert_leaf_hint.
+ *
+ **************************************/
+	const index_desc* const idx = insertion->iib_descriptor;
+	const USHORT id = idx->idx_id;
+
+	// Page headers store only the low byte of the index id,
+	// so a page of the index id + 256 would pass for ours.
+	if (id > MAX_UCHAR)
+		return;
+
+	jrd_rel* const relation = insertion->iib_relation;
+	RelationPages* const relPages = relation->getPages(tdbb);
+
+	vec<LeafHint>* hints = relPages->rel_leaf_pages;
+	if (!hints || id >= hints->count())
+	{
+		hints = relPages->rel_leaf_pages =
+			vec<LeafHint>::newVector(*relation->rel_pool, hints, id + 1);
+	}
+
+	LeafHint& hint = (*hints)[id];
+	hint.lh_root = idx->idx_root;
+	hint.lh_leaf = page;
+}
+
+
 void update_selectivity(index_root_page* root, USHORT id, const SelectivityList& selectivity)
 {
 /**************************************
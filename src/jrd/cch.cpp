@@ -206,6 +206,31 @@ const int PRE_EXISTS		= -1;
 const int PRE_UNKNOWN		= -2;
 
 
+void CCH_advise_read(thread_db* tdbb, USHORT pageSpaceId, const ULONG* pages, FB_SIZE_T count)
+{
+/**************************************
+ *
+ *	C C H _ a d v i s e _ r e a d
+ *
+ **************************************
+ *
+ * Functional description
+ *	Hint the operating system about pages which are going to be read
+ *	soon. Pages should be in ascending order.
+ *
+ **************************************/
+	SET_TDBB(tdbb);
+	Database* const dbb = tdbb->getDatabase();
+
+	if (!count || (dbb->dbb_flags & DBB_no_fs_cache))
+		return;
+
+	const PageSpace* const pageSpace = dbb->dbb_page_manager.findPageSpace(pageSpaceId);
+	if (pageSpace && pageSpace->file)
+		PIO_advise_read(tdbb, pageSpace->file, pages, count);
+}
+
+
 int CCH_down_grade_dbb(void* ast_object)
 {
 /**************************************
@@ -586,7 +611,7 @@ pag* CCH_fake(thread_db* tdbb, WIN* window, int wait)
 	bdb->bdb_flags |= (BDB_writer | BDB_faked);
 	bdb->bdb_scan_count = 0;
 
-	if (!(bcb->bcb_flags & BCB_exclusive))
+	if (!(bcb->bcb_flags & BCB_exclusive) && !window->win_page.isTemporary())
 		lock_buffer(tdbb, bdb, LCK_WAIT, pag_undefined);
 
 	MOVE_CLEAR(bdb->bdb_buffer, (SLONG) dbb->dbb_page_size);
@@ -709,7 +734,11 @@ LockState CCH_fetch_lock(thread_db* tdbb, WIN* window, int lock_type, int wait,
 	window->win_bdb = bdb;
 	window->win_buffer = bdb->bdb_buffer;
 
-	if (bcb->bcb_flags & BCB_exclusive)
+	// Pages of temporary page space are private to the attachment (Classic
+	// and SuperClassic give every attachment its own temporary page space),
+	// so there is nobody to protect them from by a page lock.
+
+	if ((bcb->bcb_flags & BCB_exclusive) || window->win_page.isTemporary())
 		return (bdb->bdb_flags & BDB_read_pending) ? lsLocked : lsLockedHavePage;
 
 	// lock_buffer returns 0 or 1 or -1.
@@ -40,6 +40,7 @@ enum LockState {
 	lsError
 };
 
+void		CCH_advise_read(Jrd::thread_db*, USHORT, const ULONG*, FB_SIZE_T);
 int			CCH_down_grade_dbb(void*);
 bool		CCH_exclusive(Jrd::thread_db*, USHORT, SSHORT, Firebird::Sync*);
 bool		CCH_exclusive_attachment(Jrd::thread_db*, USHORT, SSHORT, Firebird::Sync*);
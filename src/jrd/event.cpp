@@ -367,6 +367,9 @@ SLONG EventManager::queEvents(SLONG session_id,
 
 	if (flag)
 	{
+		session = (ses*) SRQ_ABS_PTR(session_id);
+		session->ses_flags |= SES_pending;
+
 		if (!post_process((prb*) SRQ_ABS_PTR(m_processOffset)))
 		{
 			release_shmem();
@@ -446,6 +449,9 @@ void EventManager::postEvent(USHORT length, const TEXT* string, USHORT count)
 
 				if (interest->rint_count <= event->evnt_count)
 				{
+					ses* const session = (ses*) SRQ_ABS_PTR(request->req_session);
+					session->ses_flags |= SES_pending;
+
 					prb* const process = (prb*) SRQ_ABS_PTR(request->req_process);
 					process->prb_flags |= PRB_wakeup;
 				}
@@ -475,26 +481,19 @@ void EventManager::deliverEvents()
  **************************************/
 	acquire_shmem();
 
-	// Deliver requests for posted events
-
-	bool flag = true;
+	// Deliver requests for posted events. Every process is woken up once,
+	// post_process() doesn't change the processes que.
 
-	while (flag)
+	srq* event_srq;
+	SRQ_LOOP (m_sharedMemory->getHeader()->evh_processes, event_srq)
 	{
-		flag = false;
-		srq* event_srq;
-		SRQ_LOOP (m_sharedMemory->getHeader()->evh_processes, event_srq)
+		prb* const process = (prb*) ((UCHAR*) event_srq - offsetof(prb, prb_processes));
+		if (process->prb_flags & PRB_wakeup)
 		{
-			prb* const process = (prb*) ((UCHAR*) event_srq - offsetof(prb, prb_processes));
-			if (process->prb_flags & PRB_wakeup)
+			if (!post_process(process))
 			{
-				if (!post_process(process))
-				{
-					release_shmem();
-					(Firebird::Arg::Gds(isc_random) << "post_process() failed").raise();
-				}
-				flag = true;
-				break;
+				release_shmem();
+				(Firebird::Arg::Gds(isc_random) << "post_process() failed").raise();
 			}
 		}
 	}
@@ -713,6 +712,18 @@ void EventManager::delete_event(evnt* event)
  *	Delete an unused and unloved event.
  *
  **************************************/
+	const SRQ_PTR event_offset = SRQ_REL_PTR(event);
+
+	for (SRQ_PTR* ptr = hash_slot(event->evnt_length, event->evnt_name); *ptr;
+		 ptr = &((evnt*) SRQ_ABS_PTR(*ptr))->evnt_hash_next)
+	{
+		if (*ptr == event_offset)
+		{
+			*ptr = event->evnt_hash_next;
+			break;
+		}
+	}
+
 	remove_que(&event->evnt_events);
 	free_global((frb*) event);
 }
@@ -861,6 +872,16 @@ void EventManager::deliver()
 	while (que2 != &process->prb_sessions)
 	{
 		ses* session = (ses*) ((UCHAR*) que2 - offsetof(ses, ses_sessions));
+
+		// Don't walk requests of sessions which got nothing posted
+
+		if (!(session->ses_flags & SES_pending))
+		{
+			que2 = SRQ_NEXT((*que2));
+			continue;
+		}
+
+		session->ses_flags &= ~SES_pending;
 		session->ses_flags |= SES_delivering;
 		const SLONG session_offset = SRQ_REL_PTR(session);
 		const SLONG que2_offset = SRQ_REL_PTR(que2);
@@ -974,13 +995,14 @@ evnt* EventManager::find_event(USHORT length, const TEXT* string)
  *	Lookup an event.
  *
  **************************************/
-	srq* event_srq;
-	SRQ_LOOP(m_sharedMemory->getHeader()->evh_events, event_srq)
+	for (SRQ_PTR offset = *hash_slot(length, string); offset;)
 	{
-		evnt* const event = (evnt*) ((UCHAR*) event_srq - offsetof(evnt, evnt_events));
+		evnt* const event = (evnt*) SRQ_ABS_PTR(offset);
 
 		if (event->evnt_length == length && !memcmp(string, event->evnt_name, length))
 			return event;
+
+		offset = event->evnt_hash_next;
 	}
 
 	return NULL;
@@ -1044,6 +1066,27 @@ void EventManager::free_global(frb* block)
 }
 
 
+SRQ_PTR* EventManager::hash_slot(USHORT length, const TEXT* string)
+{
+/**************************************
+ *
+ *	h a s h _ s l o t
+ *
+ **************************************
+ *
+ * Functional description
+ *	Return the slot of events hash table for given event name.
+ *
+ **************************************/
+	ULONG value = 0;
+
+	for (const UCHAR* p = (const UCHAR*) string; length; --length)
+		value = (value << 5) + value + *p++;
+
+	return &m_sharedMemory->getHeader()->evh_hash_table[value % EVENT_HASH_SIZE];
+}
+
+
 req_int* EventManager::historical_interest(ses* session, SRQ_PTR event_offset)
 {
 /**************************************
@@ -1104,6 +1147,7 @@ bool EventManager::initialize(SharedMemoryBase* sm, bool init)
 
 		SRQ_INIT(header->evh_processes);
 		SRQ_INIT(header->evh_events);
+		memset(header->evh_hash_table, 0, sizeof(header->evh_hash_table));
 
 		frb* const free = (frb*) ((UCHAR*) header + sizeof(evh));
 		free->frb_header.hdr_length = sm->sh_mem_length_mapped - sizeof(evh);
@@ -1157,6 +1201,10 @@ evnt* EventManager::make_event(USHORT length, const TEXT* string)
 	event->evnt_length = length;
 	memcpy(event->evnt_name, string, length);
 
+	SRQ_PTR* const slot = hash_slot(length, string);
+	event->evnt_hash_next = *slot;
+	*slot = SRQ_REL_PTR(event);
+
 	return event;
 }
 
@@ -33,7 +33,9 @@
 
 // Global section header
 
-const USHORT EVENT_VERSION = 4;
+const USHORT EVENT_VERSION = 5;
+
+const ULONG EVENT_HASH_SIZE = 503;	// Number of slots in events hash table
 
 class evh : public Firebird::MemoryHeader
 {
@@ -44,6 +46,7 @@ public:
 	SRQ_PTR evh_free;				// Free blocks
 	SRQ_PTR evh_current_process;	// Current process, if any
 	SLONG evh_request_id;			// Next request id
+	SRQ_PTR evh_hash_table[EVENT_HASH_SIZE];	// Known events by name
 };
 
 // Common block header
@@ -99,6 +102,7 @@ struct ses
 
 const int SES_delivering	= 1;	// Watcher thread is delivering an event
 const int SES_purge			= 2;	// delete session after delivering an event
+const int SES_pending		= 4;	// Some request of session could be satisfied
 
 // Event block
 
@@ -107,6 +111,7 @@ struct evnt
 	event_hdr evnt_header;
 	srq evnt_events;				// System event que (owned by header)
 	srq evnt_interests;				// Que of request interests in event
+	SRQ_PTR evnt_hash_next;			// Next event in the same hash slot
 	SLONG evnt_count;				// Current event count
 	USHORT evnt_length;				// Length of event name
 	TEXT evnt_name[1];				// Event name
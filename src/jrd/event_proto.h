@@ -90,6 +90,7 @@ private:
 	void attach_shared_file();
 	void detach_shared_file();
 	void get_shared_file_name(Firebird::PathName&) const;
+	SRQ_PTR* hash_slot(USHORT, const TEXT*);
 
 	static THREAD_ENTRY_DECLARE watcher_thread(THREAD_ENTRY_PARAM arg)
 	{
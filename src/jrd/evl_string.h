@@ -71,6 +71,32 @@ static void preKmp(const CharType *x, int m, SLONG kmpNext[])
 	kmpNext[++i] = ++j;
 }
 
+// Find the first occurrence of the character in the data, or return the end.
+// Single-byte data uses memchr, which the C library usually implements with
+// vector instructions chosen for the running CPU.
+template <typename CharType>
+inline const CharType* findChar(const CharType* data, const CharType* end, const CharType c)
+{
+	while (data < end && *data != c)
+		data++;
+
+	return data;
+}
+
+template <>
+inline const UCHAR* findChar<UCHAR>(const UCHAR* data, const UCHAR* end, const UCHAR c)
+{
+	const void* const found = memchr(data, c, end - data);
+	return found ? static_cast<const UCHAR*>(found) : end;
+}
+
+template <>
+inline const char* findChar<char>(const char* data, const char* end, const char c)
+{
+	const void* const found = memchr(data, c, end - data);
+	return found ? static_cast<const char*>(found) : end;
+}
+
 class StaticAllocator
 {
 public:
@@ -194,6 +220,15 @@ public:
 		SLONG data_pos = 0;
 		while (data_pos < data_len)
 		{
+			// Nothing is matched yet, skip to the next candidate position
+			if (offset == 0)
+			{
+				data_pos = findChar(data + data_pos, data + data_len, pattern_str[0]) - data;
+
+				if (data_pos >= data_len)
+					break;
+			}
+
 			while (offset > -1 && pattern_str[offset] != data[data_pos])
 				offset = kmpNext[offset];
 			offset++;
@@ -490,6 +525,17 @@ bool LikeEvaluator<CharType>::processNextChunk(const CharType* data, SLONG data_
 
 	while (data_pos < data_len)
 	{
+		// Single search branch with nothing matched yet: skip to the next candidate position
+		if (branches.getCount() == 1 && branches[0].offset == 0 &&
+			branches[0].pattern->type == piSearch && branches[0].pattern->str.length > 0)
+		{
+			const CharType first = branches[0].pattern->str.data[0];
+			data_pos = findChar(data + data_pos, data + data_len, first) - data;
+
+			if (data_pos >= data_len)
+				break;
+		}
+
 		FB_SIZE_T branch_number = 0;
 		while (branch_number < branches.getCount())
 		{
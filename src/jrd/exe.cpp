@@ -417,6 +417,18 @@ void EXE_assignment(thread_db* tdbb, const ValueExprNode* to, dsc* from_desc, bo
 			memcpy(to_desc->dsc_address, from_desc->dsc_address, from_desc->dsc_length);
 		}
 
+		// Clear the unused tail of a varying record field. Otherwise it keeps
+		// the leftovers of a longer prior value, which compress badly.
+
+		if (to_desc->dsc_dtype == dtype_varying && ExprNode::is<FieldNode>(to))
+		{
+			const vary* const varying = reinterpret_cast<vary*>(to_desc->dsc_address);
+			const ULONG used = sizeof(USHORT) + varying->vary_length;
+
+			if (used < to_desc->dsc_length)
+				memset(to_desc->dsc_address + used, 0, to_desc->dsc_length - used);
+		}
+
 		to_desc->dsc_flags &= ~DSC_null;
 	}
 	else
@@ -27,6 +27,7 @@
 #include "fb_exception.h"
 #include "iberror.h"
 
+#include "../../common/config/config.h"
 #include "../../dsql/chars.h"
 #include "../../dsql/ExprNodes.h"
 #include "../common/dsc.h"
@@ -154,8 +155,13 @@ void Manager::jrdAttachmentEnd(thread_db* tdbb, Jrd::Attachment* att)
 
 int Manager::shutdown()
 {
-	for (Provider* prv = m_providers; prv; prv = prv->m_next) {
+	FbLocalStatus status;
+	ThreadContextHolder tdbb(&status);
+
+	for (Provider* prv = m_providers; prv; prv = prv->m_next)
+	{
 		prv->cancelConnections();
+		prv->closeIdleConnections(tdbb);
 	}
 	return 0;
 }
@@ -166,6 +172,9 @@ int Manager::shutdown()
 Provider::Provider(const char* prvName) :
 	m_name(getPool()),
 	m_connections(getPool()),
+	m_idleConnections(getPool()),
+	m_idleTimer(FB_NEW IdleTimer(this)),
+	m_poolClosed(false),
 	m_flags(0)
 {
 	m_name = prvName;
@@ -173,6 +182,8 @@ Provider::Provider(const char* prvName) :
 
 Provider::~Provider()
 {
+	m_idleTimer->destroy();
+
 	thread_db* tdbb = JRD_get_thread_data();
 	clearConnections(tdbb);
 }
@@ -185,6 +196,9 @@ Connection* Provider::getConnection(thread_db* tdbb, const string& dbName,
 	if (attachment->att_ext_call_depth >= MAX_CALLBACKS)
 		ERR_post(Arg::Gds(isc_exec_sql_max_call_exceeded));
 
+	ConnectionsArray expired;
+	Connection* pooled = NULL;
+
 	{ // m_mutex scope
 		MutexLockGuard guard(m_mutex, FB_FUNCTION);
 
@@ -206,6 +220,42 @@ Connection* Provider::getConnection(thread_db* tdbb, const string& dbName,
 				conn->raise(&status, tdbb, "Provider::getConnection");
 			}
 		}
+
+		// Look for the suitable idle connection, most recently used first
+
+		pruneIdleConnections(expired);
+
+		for (FB_SIZE_T pos = m_idleConnections.getCount(); pos--; )
+		{
+			Connection* conn = m_idleConnections[pos];
+			if (conn->isSameDatabase(tdbb, dbName, user, pwd, role))
+			{
+				m_idleConnections.remove(pos);
+				pooled = conn;
+				break;
+			}
+		}
+	}
+
+	// The other side could close the connection while it was idle, for example
+	// on restart or by its own idle timeout. Don't hand out such a connection,
+	// attach again instead.
+
+	if (pooled && !pooled->ping(tdbb))
+	{
+		expired.add(pooled);
+		pooled = NULL;
+	}
+
+	deleteConnections(tdbb, expired);
+
+	if (pooled)
+	{
+		MutexLockGuard guard(m_mutex, FB_FUNCTION);
+
+		pooled->m_boundAtt = attachment;
+		m_connections.add(pooled);
+		return pooled;
 	}
 
 	Connection* conn = doCreateConnection();
@@ -228,10 +278,15 @@ Connection* Provider::getConnection(thread_db* tdbb, const string& dbName,
 	return conn;
 }
 
-// hvlad: in current implementation I didn't return connections in pool as
-// I have not implemented way to delete long idle connections.
-void Provider::releaseConnection(thread_db* tdbb, Connection& conn, bool /*inPool*/)
+// Unused connection is put into the pool of idle connections if pool is
+// enabled and connection is fit for reuse. Idle connections are deleted
+// when their lifetime is over or when pool size limit is reached.
+void Provider::releaseConnection(thread_db* tdbb, Connection& conn, bool inPool)
 {
+	ConnectionsArray expired;
+	bool pooled = false;
+	unsigned timeout = 0;
+
 	{ // m_mutex scope
 		MutexLockGuard guard(m_mutex, FB_FUNCTION);
 
@@ -245,8 +300,136 @@ void Provider::releaseConnection(thread_db* tdbb, Connection& conn, bool /*inPoo
 		}
 
 		m_connections.remove(pos);
+
+		if (inPool && !m_poolClosed && Config::getExtConnPoolSize() &&
+			conn.isConnected() && conn.isPoolable())
+		{
+			conn.m_released = time(NULL);
+			m_idleConnections.add(&conn);
+			pooled = true;
+		}
+
+		pruneIdleConnections(expired);
+		timeout = getIdleTimeout();
+	}
+
+	if (timeout)
+		m_idleTimer->start(timeout);
+
+	deleteConnections(tdbb, expired);
+
+	if (!pooled)
+		Connection::deleteConnection(tdbb, &conn);
+}
+
+void Provider::pruneIdleConnections(ConnectionsArray& expired)
+{
+	if (m_idleConnections.isEmpty())
+		return;
+
+	const FB_SIZE_T maxCount = Config::getExtConnPoolSize();
+	const time_t oldest = time(NULL) - Config::getExtConnPoolLifeTime();
+
+	// Connections are ordered by time of release, oldest go first
+
+	FB_SIZE_T count = 0;
+	while (count < m_idleConnections.getCount() &&
+		(m_idleConnections.getCount() - count > maxCount ||
+		 m_idleConnections[count]->m_released < oldest))
+	{
+		expired.add(m_idleConnections[count++]);
+	}
+
+	if (count)
+		m_idleConnections.removeCount(0, count);
+}
+
+unsigned Provider::getIdleTimeout() const
+{
+	if (m_idleConnections.isEmpty())
+		return 0;
+
+	const time_t expires = m_idleConnections[0]->m_released + Config::getExtConnPoolLifeTime();
+	const time_t now = time(NULL);
+
+	return (expires > now) ? (unsigned) (expires - now) : 1;
+}
+
+void Provider::expireIdleConnections(thread_db* tdbb)
+{
+	ConnectionsArray expired;
+	unsigned timeout = 0;
+
+	{ // m_mutex scope
+		MutexLockGuard guard(m_mutex, FB_FUNCTION);
+
+		pruneIdleConnections(expired);
+		timeout = getIdleTimeout();
+	}
+
+	if (timeout)
+		m_idleTimer->start(timeout);
+
+	deleteConnections(tdbb, expired);
+}
+
+void Provider::IdleTimer::start(unsigned seconds)
+{
+	FbLocalStatus s;
+	TimerInterfacePtr()->start(&s, this, (ISC_UINT64) seconds * 1000 * 1000);
+	// ignore error, idle connections are pruned on the next use of the pool anyway
+}
+
+void Provider::IdleTimer::destroy()
+{
+	m_provider = NULL;
+
+	FbLocalStatus s;
+	TimerInterfacePtr()->stop(&s, this);
+	// ignore error in stop timer
+}
+
+void Provider::IdleTimer::handler()
+{
+	if (!m_provider)
+		return;
+
+	// Timer thread is not bound to any attachment
+	FbLocalStatus status;
+	ThreadContextHolder tdbb(&status);
+
+	try
+	{
+		m_provider->expireIdleConnections(tdbb);
+	}
+	catch (const Exception&)
+	{} // no-op
+}
+
+int Provider::IdleTimer::release()
+{
+	if (--refCounter == 0)
+	{
+		delete this;
+		return 0;
 	}
-	Connection::deleteConnection(tdbb, &conn);
+
+	return 1;
+}
+
+void Provider::deleteConnections(thread_db* tdbb, ConnectionsArray& conns)
+{
+	for (Connection** ptr = conns.begin(); ptr < conns.end(); ptr++)
+	{
+		try
+		{
+			Connection::deleteConnection(tdbb, *ptr);
+		}
+		catch (const Exception&)
+		{} // no-op
+	}
+
+	conns.clear();
 }
 
 void Provider::clearConnections(thread_db* tdbb)
@@ -265,6 +448,14 @@ void Provider::clearConnections(thread_db* tdbb)
 	}
 
 	m_connections.clear();
+
+	for (ptr = m_idleConnections.begin(); ptr < m_idleConnections.end(); ptr++)
+	{
+		Connection::deleteConnection(tdbb, *ptr);
+		*ptr = NULL;
+	}
+
+	m_idleConnections.clear();
 }
 
 void Provider::cancelConnections()
@@ -279,6 +470,26 @@ void Provider::cancelConnections()
 	}
 }
 
+// Called at engine shutdown. Idle connections must be detached while the
+// providers and their plugins are still alive, and connections released
+// by the attachments being shut down are not pooled any more.
+void Provider::closeIdleConnections(thread_db* tdbb)
+{
+	ConnectionsArray idle;
+
+	{ // m_mutex scope
+		MutexLockGuard guard(m_mutex, FB_FUNCTION);
+
+		m_poolClosed = true;
+		idle.assign(m_idleConnections.begin(), m_idleConnections.getCount());
+		m_idleConnections.clear();
+	}
+
+	m_idleTimer->destroy();
+
+	deleteConnections(tdbb, idle);
+}
+
 // Connection
 
 Connection::Connection(Provider& prov) :
@@ -295,7 +506,8 @@ Connection::Connection(Provider& prov) :
 	m_deleting(false),
 	m_sqlDialect(0),
 	m_wrapErrors(true),
-	m_broken(false)
+	m_broken(false),
+	m_released(0)
 {
 }
 
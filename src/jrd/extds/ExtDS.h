@@ -26,6 +26,7 @@
 #include "../../common/classes/fb_string.h"
 #include "../../common/classes/array.h"
 #include "../../common/classes/ClumpletWriter.h"
+#include "../../common/classes/ImplementHelper.h"
 #include "../../common/classes/locks.h"
 #include "../../common/utils_proto.h"
 
@@ -104,6 +105,9 @@ public:
 	// cancel execution of every connection
 	void cancelConnections();
 
+	// stop pooling, delete idle connections and stop the idle timer
+	void closeIdleConnections(Jrd::thread_db* tdbb);
+
 	const Firebird::string& getName() const { return m_name; }
 
 	virtual void initialize() = 0;
@@ -120,9 +124,44 @@ public:
 	}
 
 protected:
+	typedef Firebird::HalfStaticArray<Connection*, 16> ConnectionsArray;
+
 	void clearConnections(Jrd::thread_db* tdbb);
 	virtual Connection* doCreateConnection() = 0;
 
+	// Move expired and superfluous idle connections into given array, the
+	// caller should delete them after m_mutex is released
+	void pruneIdleConnections(ConnectionsArray& expired);
+	static void deleteConnections(Jrd::thread_db* tdbb, ConnectionsArray& conns);
+
+	// Seconds until the oldest idle connection expires, zero if there are no
+	// idle connections. Must be called with m_mutex locked.
+	unsigned getIdleTimeout() const;
+
+	// Delete expired idle connections, called by m_idleTimer
+	void expireIdleConnections(Jrd::thread_db* tdbb);
+
+	// Fires when the oldest idle connection expires, so that idle connections
+	// are deleted also when nobody gets or releases connections
+	class IdleTimer FB_FINAL :
+		public Firebird::RefCntIface<Firebird::ITimerImpl<IdleTimer, Firebird::CheckStatusWrapper> >
+	{
+	public:
+		explicit IdleTimer(Provider* provider)
+			: m_provider(provider)
+		{ }
+
+		void start(unsigned seconds);
+		void destroy();
+
+		// ITimer implementation
+		void handler();
+		int release();
+
+	private:
+		Provider* m_provider;
+	};
+
 	// Protection against simultaneous attach database calls. Not sure we still
 	// need it, but i believe it will not harm
 	Firebird::Mutex m_mutex;
@@ -131,6 +170,13 @@ protected:
 	Provider* m_next;
 
 	Firebird::Array<Connection*> m_connections;
+
+	// Idle connections not bound to any attachment, ordered by time of
+	// release. Reused by any attachment asking for the same database and
+	// the same credentials.
+	Firebird::Array<Connection*> m_idleConnections;
+	Firebird::RefPtr<IdleTimer> m_idleTimer;
+	bool m_poolClosed;
 	int m_flags;
 };
 
@@ -172,6 +218,12 @@ public:
 
 	virtual bool isConnected() const = 0;
 
+	// Check that the other side still serves this connection
+	virtual bool ping(Jrd::thread_db* /*tdbb*/)
+	{
+		return isConnected();
+	}
+
 	virtual bool isSameDatabase(Jrd::thread_db* tdbb, const Firebird::string& dbName,
 		const Firebird::MetaName& user, const Firebird::string& pwd,
 		const Firebird::MetaName& role) const;
@@ -181,6 +233,12 @@ public:
 		return m_broken;
 	}
 
+	// Could this connection be kept in the pool of idle connections
+	virtual bool isPoolable() const
+	{
+		return !m_broken;
+	}
+
 	// Search for existing transaction of given scope, may return NULL.
 	Transaction* findTransaction(Jrd::thread_db* tdbb, TraScope traScope) const;
 
@@ -245,6 +303,7 @@ protected:
 	int m_sqlDialect;	// must be filled in attach call
 	bool m_wrapErrors;
 	bool m_broken;
+	time_t m_released;	// when connection was put into pool of idle connections
 };
 
 
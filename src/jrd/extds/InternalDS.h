@@ -79,6 +79,10 @@ public:
 
 	bool isCurrent() const { return m_isCurrent; }
 
+	// Pooled connection to the own database would keep it open after the
+	// last user attachment is gone
+	virtual bool isPoolable() const { return false; }
+
 	Jrd::JAttachment* getJrdAtt() { return m_attachment; }
 
 	virtual Blob* createBlob();
@@ -218,6 +218,30 @@ bool IscConnection::cancelExecution()
 	return !(status->getState() & IStatus::STATE_ERRORS);
 }
 
+// Ask the remote side for something to make sure the connection is still usable
+bool IscConnection::ping(thread_db* tdbb)
+{
+	if (!m_handle)
+		return false;
+
+	FbLocalStatus status;
+	{
+		EngineCallbackGuard guard(tdbb, *this, FB_FUNCTION);
+
+		const char info[] = {isc_info_attachment_id, isc_info_end};
+		char buff[16];
+		m_iscProvider.isc_database_info(&status, &m_handle, sizeof(info), info, sizeof(buff), buff);
+	}
+
+	if (status->getState() & IStatus::STATE_ERRORS)
+	{
+		m_broken = true;
+		return false;
+	}
+
+	return true;
+}
+
 // this ISC connection instance is available for the current execution context if it
 // a) has no active statements or supports many active statements
 //    and
@@ -519,6 +519,7 @@ public:
 	virtual bool isAvailable(Jrd::thread_db* tdbb, TraScope traScope) const;
 
 	virtual bool isConnected() const { return (m_handle != 0); }
+	virtual bool ping(Jrd::thread_db* tdbb);
 
 	virtual Blob* createBlob();
 
@@ -180,6 +180,8 @@ enum irq_type_t
 
 	irq_linger,				// get database linger value
 	irq_dbb_ss_definer,		// get database sql security value
+	irq_l_db_triggers,		// lookup database triggers
+	irq_l_ddl_triggers,		// lookup DDL triggers
 
 	irq_MAX
 };
@@ -780,6 +780,8 @@ RecordSource* OPT_compile(thread_db* tdbb, CompilerScratch* csb, RseNode* rse,
 	for (StreamType i = 0; i < opt->compileStreams.getCount(); i++)
 		check_indices(&csb->csb_rpt[opt->compileStreams[i]]);
 
+	SortedStream* sortedStream = NULL;
+
 	if (project || sort)
 	{
 		// CVC: I'm not sure how to do this with Array in a clearer way.
@@ -802,11 +804,17 @@ RecordSource* OPT_compile(thread_db* tdbb, CompilerScratch* csb, RseNode* rse,
 
 		// Handle project clause, if present
 		if (project)
-			rsb = OPT_gen_sort(tdbb, opt->opt_csb, opt->beds, &opt->keyStreams, rsb, project, true);
+		{
+			rsb = sortedStream =
+				OPT_gen_sort(tdbb, opt->opt_csb, opt->beds, &opt->keyStreams, rsb, project, true);
+		}
 
 		// Handle sort clause if present
 		if (sort)
-			rsb = OPT_gen_sort(tdbb, opt->opt_csb, opt->beds, &opt->keyStreams, rsb, sort, false);
+		{
+			rsb = sortedStream =
+				OPT_gen_sort(tdbb, opt->opt_csb, opt->beds, &opt->keyStreams, rsb, sort, false);
+		}
 	}
 
     // Handle first and/or skip.  The skip MUST (if present)
@@ -814,11 +822,20 @@ RecordSource* OPT_compile(thread_db* tdbb, CompilerScratch* csb, RseNode* rse,
     // functions add their nodes at the beginning of the rsb list we MUST call
     // gen_skip before gen_first.
 
+	SkipRowsStream* skipStream = NULL;
+
     if (rse->rse_skip)
-		rsb = FB_NEW_POOL(*pool) SkipRowsStream(csb, rsb, rse->rse_skip);
+		rsb = skipStream = FB_NEW_POOL(*pool) SkipRowsStream(csb, rsb, rse->rse_skip);
 
 	if (rse->rse_first)
-		rsb = FB_NEW_POOL(*pool) FirstRowsStream(csb, rsb, rse->rse_first);
+	{
+		FirstRowsStream* const firstStream = FB_NEW_POOL(*pool) FirstRowsStream(csb, rsb, rse->rse_first);
+		rsb = firstStream;
+
+		// Let the sort keep only the rows to be fetched
+		if (sortedStream)
+			sortedStream->setLimit(firstStream, skipStream);
+	}
 
 	if (rse->flags & RseNode::FLAG_WRITELOCK)
 	{
@@ -37,6 +37,7 @@ namespace Ods {
 }
 
 int		PIO_add_file(Jrd::thread_db*, Jrd::jrd_file*, const Firebird::PathName&, SLONG);
+void	PIO_advise_read(Jrd::thread_db*, Jrd::jrd_file*, const ULONG*, FB_SIZE_T);
 void	PIO_close(Jrd::jrd_file*);
 Jrd::jrd_file*	PIO_create(Jrd::thread_db*, const Firebird::PathName&,
 							const bool, const bool);
@@ -383,6 +383,54 @@ void PIO_erase(const jrd_file* file)
 }
 
 
+void PIO_advise_read(thread_db* tdbb, jrd_file* main_file, const ULONG* pages, FB_SIZE_T count)
+{
+/**************************************
+ *
+ *	P I O _ a d v i s e _ r e a d
+ *
+ **************************************
+ *
+ * Functional description
+ *	Let the OS know that given pages will be read soon, so it could start
+ *	to read them in background. Adjacent pages are advised as one range.
+ *	Nothing is done if file system cache is not used.
+ *
+ **************************************/
+#if defined(HAVE_POSIX_FADVISE) && defined(POSIX_FADV_WILLNEED)
+	Database* const dbb = tdbb->getDatabase();
+	const ULONG pageSize = dbb->dbb_page_size;
+
+	for (const ULONG* const end = pages + count; pages < end;)
+	{
+		const ULONG first = *pages++;
+		ULONG last = first;
+
+		while (pages < end && *pages == last + 1)
+			last = *pages++;
+
+		for (jrd_file* file = main_file; file; file = file->fil_next)
+		{
+			if (first < file->fil_min_page || first > file->fil_max_page)
+				continue;
+
+			if (file->fil_desc == -1 || (file->fil_flags & FIL_no_fs_cache))
+				break;
+
+			const ULONG lastInFile = MIN(last, file->fil_max_page);
+			const FB_UINT64 offset = (FB_UINT64) (first - file->fil_min_page + file->fil_fudge) * pageSize;
+			const FB_UINT64 length = (FB_UINT64) (lastInFile - first + 1) * pageSize;
+
+			if (offset == (FB_UINT64) LSEEK_OFFSET_CAST offset)
+				os_utils::posix_fadvise(file->fil_desc, offset, length, POSIX_FADV_WILLNEED);
+
+			break;
+		}
+	}
+#endif
+}
+
+
 void PIO_flush(thread_db* tdbb, jrd_file* main_file)
 {
 /**************************************
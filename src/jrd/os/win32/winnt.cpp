@@ -338,6 +338,21 @@ void PIO_erase(const jrd_file* file)
 	}
 }
 
+void PIO_advise_read(thread_db*, jrd_file*, const ULONG*, FB_SIZE_T)
+{
+/**************************************
+ *
+ *	P I O _ a d v i s e _ r e a d
+ *
+ **************************************
+ *
+ * Functional description
+ *	Read-ahead hints are not supported, Windows does its own
+ *	read-ahead for sequential access.
+ *
+ **************************************/
+}
+
 void PIO_flush(thread_db* tdbb, jrd_file* main_file)
 {
 /**************************************
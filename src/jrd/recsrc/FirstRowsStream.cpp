@@ -140,3 +140,10 @@ void FirstRowsStream::nullRecords(thread_db* tdbb) const
 {
 	m_next->nullRecords(tdbb);
 }
+
+SINT64 FirstRowsStream::getCount(jrd_req* request) const
+{
+	// Number of rows still to be returned
+	const Impure* const impure = request->getImpure<Impure>(m_impure);
+	return impure->irsb_count;
+}
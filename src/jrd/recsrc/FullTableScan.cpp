@@ -58,6 +58,8 @@ void FullTableScan::open(thread_db* tdbb) const
 	// effect of large sequential scans on the page working sets of
 	// other attachments
 
+	const ULONG dataPages = DPM_data_pages(tdbb, m_relation);
+
 	if (attachment && (attachment != dbb->dbb_attachments || attachment->att_next))
 	{
 		// If the relation has more data pages than the number of
@@ -71,13 +73,24 @@ void FullTableScan::open(thread_db* tdbb) const
 
 		BufferControl* const bcb = dbb->dbb_bcb;
 
-		if (attachment->isGbak() || DPM_data_pages(tdbb, m_relation) > bcb->bcb_count)
+		if (attachment->isGbak() || dataPages > bcb->bcb_count)
 		{
 			rpb->getWindow(tdbb).win_flags = WIN_large_scan;
 			rpb->rpb_org_scans = m_relation->rel_scan_count++;
 		}
 	}
 
+	// Relations not fitting into the page cache are going to be read from
+	// disk anyway, let DPM_next() ask the OS to read their data pages ahead
+
+	if (dataPages > dbb->dbb_bcb->bcb_count)
+		rpb->rpb_stream_flags |= RPB_s_read_ahead;
+	else
+		rpb->rpb_stream_flags &= ~RPB_s_read_ahead;
+
+	rpb->rpb_ra_next = 0;
+	rpb->rpb_ra_pages = 0;
+
 	RLCK_reserve_relation(tdbb, request->req_transaction, m_relation, false);
 
 	rpb->rpb_number.setValue(BOF_NUMBER);
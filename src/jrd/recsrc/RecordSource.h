@@ -415,6 +415,8 @@ namespace Jrd
 			m_next->setAnyBoolean(anyBoolean, ansiAny, ansiNot);
 		}
 
+		SINT64 getCount(jrd_req* request) const;
+
 	private:
 		NestConst<RecordSource> m_next;
 		NestConst<ValueExprNode> const m_value;
@@ -451,6 +453,8 @@ namespace Jrd
 			m_next->setAnyBoolean(anyBoolean, ansiAny, ansiNot);
 		}
 
+		SINT64 getCount(jrd_req* request) const;
+
 	private:
 		NestConst<RecordSource> m_next;
 		NestConst<ValueExprNode> const m_value;
@@ -555,6 +559,12 @@ namespace Jrd
 
 		SortedStream(CompilerScratch* csb, RecordSource* next, SortMap* map);
 
+		void setLimit(const FirstRowsStream* first, const SkipRowsStream* skip)
+		{
+			m_first = first;
+			m_skip = skip;
+		}
+
 		void open(thread_db* tdbb) const override;
 		void close(thread_db* tdbb) const override;
 
@@ -596,6 +606,8 @@ namespace Jrd
 
 		NestConst<RecordSource> m_next;
 		const SortMap* const m_map;
+		const FirstRowsStream* m_first;	// limits the number of rows fetched, if any
+		const SkipRowsStream* m_skip;
 	};
 
 	// Make moves in a window without going out of partition boundaries.
@@ -843,6 +855,8 @@ namespace Jrd
 			SINT64 locateFrameRange(thread_db* tdbb, jrd_req* request, Impure* impure,
 				const WindowClause::Frame* frame, const dsc* offsetDesc, SINT64 position) const;
 
+			void aggRevert(thread_db* tdbb, jrd_req* request) const;
+
 		private:
 			NestConst<SortNode> m_order;
 			const MapNode* m_windowMap;
@@ -852,6 +866,7 @@ namespace Jrd
 			NestValueArray m_winPassSources, m_winPassTargets;
 			WindowClause::Exclusion m_exclusion;
 			UCHAR m_invariantOffsets;	// 0x1 | 0x2 bitmask
+			bool m_revertible;			// all aggregates support aggRevert
 		};
 
 	public:
@@ -141,3 +141,10 @@ void SkipRowsStream::nullRecords(thread_db* tdbb) const
 {
 	m_next->nullRecords(tdbb);
 }
+
+SINT64 SkipRowsStream::getCount(jrd_req* request) const
+{
+	// Number of rows still to be skipped
+	const Impure* const impure = request->getImpure<Impure>(m_impure);
+	return impure->irsb_count ? impure->irsb_count - 1 : 0;
+}
@@ -40,7 +40,7 @@ using namespace Jrd;
 // -----------------------------
 
 SortedStream::SortedStream(CompilerScratch* csb, RecordSource* next, SortMap* map)
-	: m_next(next), m_map(map)
+	: m_next(next), m_map(map), m_first(NULL), m_skip(NULL)
 {
 	fb_assert(m_next && m_map);
 
@@ -121,7 +121,7 @@ void SortedStream::print(thread_db* tdbb, string& plan,
 		extras.printf(" (record length: %" ULONGFORMAT", key length: %" ULONGFORMAT")",
 					  m_map->length, m_map->keyLength);
 
-		plan += printIndent(++level) +
+		plan += printIndent(++level) + (m_first ? "Top-N " : "") +
 			((m_map->flags & FLAG_PROJECT) ? "Unique Sort" : "Sort") + extras;
 
 		m_next->print(tdbb, plan, true, level);
@@ -162,6 +162,14 @@ Sort* SortedStream::init(thread_db* tdbb) const
 	m_next->open(tdbb);
 	ULONG records = 0;
 
+	// If the output is limited, the streams above us are open already and
+	// know how many rows are going to be fetched. Let the sort keep only them.
+
+	FB_UINT64 maxRecords = 0;
+
+	if (m_first)
+		maxRecords = m_first->getCount(request) + (m_skip ? m_skip->getCount(request) : 0);
+
 	// Initialize for sort. If this is really a project operation,
 	// establish a callback routine to reject duplicate records.
 
@@ -169,7 +177,7 @@ Sort* SortedStream::init(thread_db* tdbb) const
 		Sort(tdbb->getDatabase(), &request->req_sorts,
 			 m_map->length, m_map->keyItems.getCount(), m_map->keyItems.getCount(),
 			 m_map->keyItems.begin(),
-			 ((m_map->flags & FLAG_PROJECT) ? rejectDuplicate : NULL), 0));
+			 ((m_map->flags & FLAG_PROJECT) ? rejectDuplicate : NULL), 0, maxRecords));
 
 	// Pump the input stream dry while pushing records into sort. For
 	// each record, map all fields into the sort record. The reverse
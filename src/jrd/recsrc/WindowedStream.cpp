@@ -432,7 +432,8 @@ WindowedStream::WindowStream::WindowStream(thread_db* tdbb, CompilerScratch* csb
 	  m_winPassSources(csb->csb_pool),
 	  m_winPassTargets(csb->csb_pool),
 	  m_exclusion(exclusion),
-	  m_invariantOffsets(0)
+	  m_invariantOffsets(0),
+	  m_revertible(true)
 {
 	// Separate nodes that requires the winPass call.
 
@@ -453,6 +454,9 @@ WindowedStream::WindowStream::WindowStream(thread_db* tdbb, CompilerScratch* csb
 			{
 				m_aggSources.add(*source);
 				m_aggTargets.add(*target);
+
+				if (!aggNode->canRevert())
+					m_revertible = false;
 			}
 
 			if (capabilities & AggNode::CAP_WANTS_WIN_PASS_CALL)
@@ -778,7 +782,29 @@ bool WindowedStream::WindowStream::getRecord(thread_db* tdbb) const
 			// This may be incompatible with some function like LIST, but currently LIST cannot
 			// be used in ordered windows anyway.
 
-			if (!lastWindow.isValid() ||
+			// When the window slides forward, remove the records that left it from the
+			// aggregation instead of aggregating all the remaining ones again, if it costs less.
+
+			if (m_revertible && lastWindow.isValid() &&
+				impure->windowBlock.startPosition > lastWindow.startPosition &&
+				impure->windowBlock.endPosition >= lastWindow.endPosition &&
+				impure->windowBlock.startPosition - lastWindow.startPosition <=
+					lastWindow.endPosition - impure->windowBlock.startPosition)
+			{
+				m_next->locate(tdbb, lastWindow.startPosition);
+				SINT64 pending = impure->windowBlock.startPosition - lastWindow.startPosition;
+
+				while (pending-- > 0)
+				{
+					if (!m_next->getRecord(tdbb))
+						fb_assert(false);
+
+					aggRevert(tdbb, request);
+				}
+
+				m_next->locate(tdbb, lastWindow.endPosition + 1);
+			}
+			else if (!lastWindow.isValid() ||
 				impure->windowBlock.startPosition > lastWindow.startPosition ||
 				impure->windowBlock.endPosition < lastWindow.endPosition)
 			{
@@ -1056,6 +1082,17 @@ SINT64 WindowedStream::WindowStream::locateFrameRange(thread_db* tdbb, jrd_req*
 	return rangePos;
 }
 
+// Remove the current record from the window aggregation.
+void WindowedStream::WindowStream::aggRevert(thread_db* tdbb, jrd_req* request) const
+{
+	for (const NestConst<ValueExprNode>* source = m_aggSources.begin();
+		 source != m_aggSources.end();
+		 ++source)
+	{
+		(*source)->as<AggNode>()->aggRevert(tdbb, request);
+	}
+}
+
 // ------------------------------
 
 SlidingWindow::SlidingWindow(thread_db* aTdbb, const BaseBufferedStream* aStream,
@@ -63,7 +63,8 @@ struct record_param
 		  rpb_b_page(0), rpb_b_line(0),
 		  rpb_address(NULL), rpb_length(0),
 		  rpb_flags(0), rpb_stream_flags(0), rpb_runtime_flags(0),
-		  rpb_org_scans(0), rpb_window(DB_PAGE_SPACE, -1)
+		  rpb_org_scans(0), rpb_max_field(0), rpb_ra_next(0), rpb_ra_pages(0),
+		  rpb_window(DB_PAGE_SPACE, -1)
 	{
 	}
 
@@ -90,6 +91,9 @@ struct record_param
 	USHORT rpb_stream_flags;		// stream flags
 	USHORT rpb_runtime_flags;		// runtime flags
 	SSHORT rpb_org_scans;			// relation scan count at stream open
+	USHORT rpb_max_field;			// highest field id accessed by the stream, see RPB_s_partial
+	ULONG rpb_ra_next;				// sequence of the first data page not read ahead yet
+	USHORT rpb_ra_pages;			// current read ahead window, see RPB_s_read_ahead
 
 	inline WIN& getWindow(thread_db* tdbb)
 	{
@@ -123,6 +127,8 @@ const USHORT rpb_long_tranum	= 1024;		// transaction number is 64-bit
 const USHORT RPB_s_update	= 0x01;	// input stream fetched for update
 const USHORT RPB_s_no_data	= 0x02;	// nobody is going to access the data
 const USHORT RPB_s_sweeper	= 0x04;	// garbage collector - skip swept pages
+const USHORT RPB_s_partial	= 0x08;	// nobody is going to access fields after rpb_max_field
+const USHORT RPB_s_read_ahead	= 0x10;	// large sequential scan - read data pages ahead
 
 // Runtime flags
 
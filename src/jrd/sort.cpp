@@ -388,22 +388,35 @@ void Sort::put(thread_db* tdbb, ULONG** record_address)
 		if ((UCHAR*) record < m_memory + m_longs ||
 			(UCHAR*) NEXT_RECORD(record) <= (UCHAR*) (m_next_pointer + 1))
 		{
-			putRun();
-			while (true)
+			// If only the first records are needed and dropping the rest frees
+			// at least half of the buffer, do it instead of writing the run.
+
+			const FB_UINT64 records = m_next_pointer - m_first_pointer - 1;
+
+			if (m_max_records && m_max_records <= records / 2)
 			{
-				run_control* run = m_runs;
-				const USHORT depth = run->run_depth;
-				if (depth == MAX_MERGE_LEVEL)
-					break;
-				USHORT count = 1;
-				while ((run = run->run_next) && run->run_depth == depth)
-					count++;
-				if (count < RUN_GROUP)
-					break;
-				mergeRuns(count);
+				trim();
+				record = m_last_record;
+			}
+			else
+			{
+				putRun();
+				while (true)
+				{
+					run_control* run = m_runs;
+					const USHORT depth = run->run_depth;
+					if (depth == MAX_MERGE_LEVEL)
+						break;
+					USHORT count = 1;
+					while ((run = run->run_next) && run->run_depth == depth)
+						count++;
+					if (count < RUN_GROUP)
+						break;
+					mergeRuns(count);
+				}
+				init();
+				record = m_last_record;
 			}
-			init();
-			record = m_last_record;
 		}
 
 		record = NEXT_RECORD(record);
@@ -2023,3 +2036,53 @@ void Sort::sortRunsBySeek(int n)
 	}
 	run->run_next = tail;
 }
+
+void Sort::trim()
+{
+/**************************************
+ *
+ * Memory has been exhausted, but only the first m_max_records
+ * records are going to be fetched. Sort what we have, keep the
+ * first records and drop the rest. Neither runs nor scratch
+ * file are needed this way.
+ *
+ **************************************/
+	sort();
+
+	// Length of the key part of the record
+	const ULONG length = m_longs - SIZEOF_SR_BCKPTR_IN_LONGS;
+
+	// Save the records to keep. Their keys are diddled already and
+	// are moved back into the buffer as is.
+
+	Array<SORTP> keep(m_owner->getPool());
+	SORTP* const buffer = keep.getBuffer((FB_SIZE_T) m_max_records * length);
+	SORTP* p = buffer;
+	FB_UINT64 count = 0;
+
+	for (sort_record** ptr = m_first_pointer + 1; ptr < m_next_pointer && count < m_max_records; ptr++)
+	{
+		// skip records eliminated as duplicates
+		if (!*ptr)
+			continue;
+
+		MOVE_32(length, *ptr, p);
+		p += length;
+		count++;
+	}
+
+	init();
+
+	for (p = buffer; p < buffer + count * length; p += length)
+	{
+		SR* const record = NEXT_RECORD(m_last_record);
+
+		m_last_record = record;
+		record->sr_bckptr = m_next_pointer;
+		*m_next_pointer++ = reinterpret_cast<sort_record*>(record->sr_sort_record.sort_record_key);
+
+		MOVE_32(length, p, record->sr_sort_record.sort_record_key);
+	}
+
+	m_records = count;
+}
@@ -306,6 +306,55 @@ UCHAR* Compressor::unpack(FB_SIZE_T inLength,
 	return output;
 }
 
+UCHAR* Compressor::unpackPrefix(FB_SIZE_T inLength,
+								const UCHAR* input,
+								FB_SIZE_T outLength,
+								UCHAR* output)
+{
+/**************************************
+ *
+ *	Decompress a compressed string into a buffer,
+ *	stopping as soon as the buffer is filled.
+ *	Return the address where the output stopped.
+ *
+ **************************************/
+	const UCHAR* const end = input + inLength;
+	const UCHAR* const output_end = output + outLength;
+
+	while (input < end && output < output_end)
+	{
+		const int len = (signed char) *input++;
+		const FB_SIZE_T room = output_end - output;
+
+		if (len < 0)
+		{
+			if (input >= end)
+			{
+				BUGCHECK(179);	// msg 179 decompression overran buffer
+			}
+
+			const UCHAR c = *input++;
+			const FB_SIZE_T count = MIN((FB_SIZE_T) -len, room);
+			memset(output, c, count);
+			output += count;
+		}
+		else
+		{
+			if (input + len > end)
+			{
+				BUGCHECK(179);	// msg 179 decompression overran buffer
+			}
+
+			const FB_SIZE_T count = MIN((FB_SIZE_T) len, room);
+			memcpy(output, input, count);
+			output += count;
+			input += len;
+		}
+	}
+
+	return output;
+}
+
 FB_SIZE_T Compressor::makeNoDiff(FB_SIZE_T outLength, UCHAR* output)
 {
 /**************************************
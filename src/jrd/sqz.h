@@ -54,6 +54,7 @@ namespace Jrd
 		FB_SIZE_T getPartialLength(FB_SIZE_T, const UCHAR*) const;
 
 		static UCHAR* unpack(FB_SIZE_T, const UCHAR*, FB_SIZE_T, UCHAR*);
+		static UCHAR* unpackPrefix(FB_SIZE_T, const UCHAR*, FB_SIZE_T, UCHAR*);
 		static FB_SIZE_T applyDiff(FB_SIZE_T, const UCHAR*, FB_SIZE_T, UCHAR* const);
 		static FB_SIZE_T makeDiff(FB_SIZE_T, const UCHAR*, FB_SIZE_T, UCHAR*, FB_SIZE_T, UCHAR*);
 		static FB_SIZE_T makeNoDiff(FB_SIZE_T, UCHAR*);
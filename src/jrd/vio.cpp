@@ -107,6 +107,8 @@ static bool dfw_should_know(record_param* org_rpb, record_param* new_rpb,
 	USHORT irrelevant_field, bool void_update_is_relevant = false);
 static void garbage_collect(thread_db*, record_param*, ULONG, RecordStack&);
 static THREAD_ENTRY_DECLARE garbage_collector(THREAD_ENTRY_PARAM);
+static void garbage_collector_thread(Database*, bool);
+static THREAD_ENTRY_DECLARE garbage_collector_worker(THREAD_ENTRY_PARAM);
 
 
 #ifdef VIO_DEBUG
@@ -1255,7 +1257,7 @@ void VIO_copy_record(thread_db* tdbb, record_param* org_rpb, record_param* new_r
 }
 
 
-void VIO_data(thread_db* tdbb, record_param* rpb, MemoryPool* pool)
+void VIO_data(thread_db* tdbb, record_param* rpb, MemoryPool* pool, bool partial)
 {
 /**************************************
  *
@@ -1265,6 +1267,8 @@ void VIO_data(thread_db* tdbb, record_param* rpb, MemoryPool* pool)
  *
  * Functional description
  *	Given an active record parameter block, fetch the full record.
+ *	If partial is set, only the fields up to rpb_max_field are
+ *	guaranteed to be fetched, the rest of the record is cleared.
  *
  *	This routine is called with an active record_param and exits with
  *	an INactive record_param.  Yes, Virginia, getting the data for a
@@ -1315,13 +1319,45 @@ void VIO_data(thread_db* tdbb, record_param* rpb, MemoryPool* pool)
 		tail_end = tail + record->getLength();
 	}
 
+	// If the caller accesses only the leading fields, there is no need
+	// to decompress the rest of the record. Delta versions are always
+	// applied to the complete record, so a record having a delta back
+	// version is decompressed completely as well.
+
+	bool prefix = false;
+
+	if (partial && !prior && !(rpb->rpb_b_page && (rpb->rpb_flags & rpb_delta)))
+	{
+		ULONG partial_length = FLAG_BYTES(format->fmt_count);
+		const USHORT count = MIN(rpb->rpb_max_field + 1, format->fmt_count);
+
+		for (USHORT i = 0; i < count; i++)
+		{
+			const dsc* const desc = &format->fmt_desc[i];
+
+			if (desc->dsc_dtype)
+			{
+				const ULONG end = (ULONG) (IPTR) desc->dsc_address + desc->dsc_length;
+				partial_length = MAX(partial_length, end);
+			}
+		}
+
+		if (partial_length < format->fmt_length)
+		{
+			tail_end = tail + partial_length;
+			prefix = true;
+		}
+	}
+
 	// Set up prior record point for next version
 
 	rpb->rpb_prior = (rpb->rpb_b_page && (rpb->rpb_flags & rpb_delta)) ? record : NULL;
 
 	// Snarf data from record
 
-	tail = Compressor::unpack(rpb->rpb_length, rpb->rpb_address, tail_end - tail, tail);
+	tail = prefix ?
+		Compressor::unpackPrefix(rpb->rpb_length, rpb->rpb_address, tail_end - tail, tail) :
+		Compressor::unpack(rpb->rpb_length, rpb->rpb_address, tail_end - tail, tail);
 
 	RuntimeStatistics::Accumulator fragments(tdbb, relation, RuntimeStatistics::RECORD_FRAGMENT_READS);
 
@@ -1331,10 +1367,14 @@ void VIO_data(thread_db* tdbb, record_param* rpb, MemoryPool* pool)
 		const USHORT back_line = rpb->rpb_b_line;
 		const USHORT save_flags = rpb->rpb_flags;
 
-		while (rpb->rpb_flags & rpb_incomplete)
+		// Don't fetch the remaining fragments if the required data is already there
+
+		while ((rpb->rpb_flags & rpb_incomplete) && !(prefix && tail == tail_end))
 		{
 			DPM_fetch_fragment(tdbb, rpb, LCK_read);
-			tail = Compressor::unpack(rpb->rpb_length, rpb->rpb_address, tail_end - tail, tail);
+			tail = prefix ?
+				Compressor::unpackPrefix(rpb->rpb_length, rpb->rpb_address, tail_end - tail, tail) :
+				Compressor::unpack(rpb->rpb_length, rpb->rpb_address, tail_end - tail, tail);
 			++fragments;
 		}
 
@@ -1357,6 +1397,13 @@ void VIO_data(thread_db* tdbb, record_param* rpb, MemoryPool* pool)
 		length = tail - record->getData();
 	}
 
+	if (prefix && tail == tail_end)
+	{
+		// Don't leave data of a previously fetched record in the fields not decompressed
+		memset(tail, 0, record->getLength() - length);
+		length = format->fmt_length;
+	}
+
 	if (format->fmt_length != length)
 	{
 #ifdef VIO_DEBUG
@@ -1916,7 +1963,10 @@ void VIO_fini(thread_db* tdbb)
 	if (dbb->dbb_flags & DBB_garbage_collector)
 	{
 		dbb->dbb_flags &= ~DBB_garbage_collector;
-		dbb->dbb_gc_sem.release(); // Wake up running thread
+
+		// Wake up running threads. With GCThreads > 1 a single release
+		// could be taken by a worker while the main thread keeps waiting.
+		dbb->dbb_gc_sem.release(dbb->dbb_config->getGCThreads());
 		dbb->dbb_gc_fini.enter();
 	}
 }
@@ -2118,7 +2168,7 @@ bool VIO_get(thread_db* tdbb, record_param* rpb, jrd_tra* transaction, MemoryPoo
 			rpb->rpb_length = 0;
 		}
 		else
-			VIO_data(tdbb, rpb, pool);
+			VIO_data(tdbb, rpb, pool, (rpb->rpb_stream_flags & RPB_s_partial));
 	}
 
 	tdbb->bumpRelStats(RuntimeStatistics::RECORD_IDX_READS, rpb->rpb_relation->rel_id);
@@ -2940,7 +2990,7 @@ bool VIO_next_record(thread_db* tdbb,
 			rpb->rpb_length = 0;
 		}
 		else
-			VIO_data(tdbb, rpb, pool);
+			VIO_data(tdbb, rpb, pool, (rpb->rpb_stream_flags & RPB_s_partial));
 	}
 
 #ifdef VIO_DEBUG
@@ -4307,15 +4357,56 @@ static THREAD_ENTRY_DECLARE garbage_collector(THREAD_ENTRY_PARAM arg)
  **************************************
  *
  * Functional description
+ *	Main garbage collector thread. It owns the
+ *	GarbageCollector instance and starts and stops
+ *	worker threads, if configured.
+ *
+ **************************************/
+	garbage_collector_thread((Database*) arg, false);
+	return 0;
+}
+
+
+static THREAD_ENTRY_DECLARE garbage_collector_worker(THREAD_ENTRY_PARAM arg)
+{
+/**************************************
+ *
+ *	g a r b a g e _ c o l l e c t o r _ w o r k e r
+ *
+ **************************************
+ *
+ * Functional description
+ *	Additional garbage collector thread. It shares
+ *	the work queued in GarbageCollector with the
+ *	main thread.
+ *
+ **************************************/
+	garbage_collector_thread((Database*) arg, true);
+	return 0;
+}
+
+
+static void garbage_collector_thread(Database* dbb, bool worker)
+{
+/**************************************
+ *
+ *	g a r b a g e _ c o l l e c t o r _ t h r e a d
+ *
+ **************************************
+ *
+ * Functional description
  *	Garbage collect the data pages marked in a
  *	relation's garbage collection bitmap. The
  *	hope is that offloading the computation
  *	and I/O burden of garbage collection will
  *	improve query response time and throughput.
  *
+ *	Every thread has its own attachment and takes
+ *	bitmaps of data pages from GarbageCollector, so
+ *	different threads never process the same pages.
+ *
  **************************************/
 	FbLocalStatus status_vector;
-	Database* const dbb = (Database*) arg;
 
 	try
 	{
@@ -4340,8 +4431,19 @@ static THREAD_ENTRY_DECLARE garbage_collector(THREAD_ENTRY_PARAM arg)
 		jrd_rel* relation = NULL;
 		jrd_tra* transaction = NULL;
 
-		AutoPtr<GarbageCollector> gc(FB_NEW_POOL(*attachment->att_pool) GarbageCollector(
-			*attachment->att_pool, dbb));
+		// Main thread creates GarbageCollector, workers use it
+		AutoPtr<GarbageCollector> gcHolder;
+		GarbageCollector* gc = dbb->dbb_garbage_collector;
+
+		if (!worker)
+		{
+			gcHolder = FB_NEW_POOL(*attachment->att_pool) GarbageCollector(
+				*attachment->att_pool, dbb);
+			gc = gcHolder;
+		}
+
+		const int threads = dbb->dbb_config->getGCThreads();
+		int workers = 0;
 
 		try
 		{
@@ -4352,14 +4454,32 @@ static THREAD_ENTRY_DECLARE garbage_collector(THREAD_ENTRY_PARAM arg)
 			PAG_attachment_id(tdbb);
 			TRA_init(attachment);
 
-			dbb->dbb_garbage_collector = gc;
+			if (!worker)
+				dbb->dbb_garbage_collector = gc;
 
 			sAtt->initDone();
 
-			// Notify our creator that we have started
-			dbb->dbb_flags |= DBB_garbage_collector;
-			dbb->dbb_flags &= ~DBB_gc_starting;
-			dbb->dbb_gc_init.release();
+			if (!worker)
+			{
+				// Notify our creator that we have started
+				dbb->dbb_flags |= DBB_garbage_collector;
+				dbb->dbb_flags &= ~DBB_gc_starting;
+				dbb->dbb_gc_init.release();
+
+				for (; workers < threads - 1; workers++)
+				{
+					try
+					{
+						Thread::start(garbage_collector_worker, dbb, THREAD_medium);
+					}
+					catch (const Exception&)
+					{
+						gds__log("Database: %s\n\tcannot start garbage collector worker thread",
+							dbb->dbb_filename.c_str());
+						break;
+					}
+				}
+			}
 
 			// The garbage collector flag is cleared to request the thread
 			// to finish up and exit.
@@ -4409,6 +4529,12 @@ static THREAD_ENTRY_DECLARE garbage_collector(THREAD_ENTRY_PARAM arg)
 						if (!gcGuard.gcEnabled())
 							continue;
 
+						// Let the next idle thread look for more work while
+						// this one is busy with the current relation
+
+						if (threads > 1)
+							dbb->dbb_gc_sem.release();
+
 						rpb.rpb_relation = relation;
 
 						while (gc_bitmap->getFirst())
@@ -4531,9 +4657,21 @@ static THREAD_ENTRY_DECLARE garbage_collector(THREAD_ENTRY_PARAM arg)
 			// continue execution to clean up
 		}
 
+		if (workers)
+		{
+			// Stop workers before GarbageCollector is gone
+
+			dbb->dbb_flags &= ~DBB_garbage_collector;
+			dbb->dbb_gc_sem.release(workers);
+
+			for (; workers; workers--)
+				dbb->dbb_gc_workers_fini.enter();
+		}
+
 		delete rpb.rpb_record;
 
-		dbb->dbb_garbage_collector = NULL;
+		if (!worker)
+			dbb->dbb_garbage_collector = NULL;
 
 		if (transaction)
 			TRA_commit(tdbb, transaction, false);
@@ -4550,6 +4688,12 @@ static THREAD_ENTRY_DECLARE garbage_collector(THREAD_ENTRY_PARAM arg)
 		iscDbLogStatus(dbb->dbb_filename.c_str(), &status_vector);
 	}
 
+	if (worker)
+	{
+		dbb->dbb_gc_workers_fini.release();
+		return;
+	}
+
 	dbb->dbb_flags &= ~(DBB_garbage_collector | DBB_gc_active | DBB_gc_pending);
 
 	try
@@ -4567,8 +4711,6 @@ static THREAD_ENTRY_DECLARE garbage_collector(THREAD_ENTRY_PARAM arg)
 		ex.stuffException(&status_vector);
 		iscDbLogStatus(dbb->dbb_filename.c_str(), &status_vector);
 	}
-
-	return 0;
 }
 
 
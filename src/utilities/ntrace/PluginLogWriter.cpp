@@ -27,7 +27,9 @@
 
 #include "PluginLogWriter.h"
 #include "../common/classes/init.h"
+#include "../common/classes/GenericMap.h"
 #include "../common/os/os_utils.h"
+#include "../common/isc_proto.h"
 
 #ifndef S_IREAD
 #define S_IREAD S_IRUSR
@@ -49,10 +51,37 @@ void strerror_r(int err, char* buf, size_t bufSize)
 }
 #endif
 
-PluginLogWriter::PluginLogWriter(const char* fileName, size_t maxSize) :
+// Flush interval of the asynchronous log buffer, in milliseconds
+const int FLUSH_INTERVAL = 500;
+
+namespace
+{
+	// Buffered writers by log file name. Plugin instances are created per
+	// attachment, and sharing the writer keeps the number of flush threads
+	// and buffers independent of the number of connections and keeps records
+	// written into the file in the order they were logged.
+	class SharedWriters
+	{
+	public:
+		explicit SharedWriters(MemoryPool& p)
+			: writers(p)
+		{}
+
+		Mutex mutex;
+		GenericMap<Pair<Left<PathName, PluginLogWriter*> > > writers;
+	};
+
+	GlobalPtr<SharedWriters> sharedWriters;
+}
+
+PluginLogWriter::PluginLogWriter(const char* fileName, size_t maxSize, size_t bufferSize) :
 	m_fileName(*getDefaultMemoryPool()),
 	m_fileHandle(-1),
-	m_maxSize(maxSize)
+	m_maxSize(maxSize),
+	m_bufferSize(bufferSize),
+	m_buffer(*getDefaultMemoryPool()),
+	m_flushBuffer(*getDefaultMemoryPool()),
+	m_shutdown(false)
 {
 	m_fileName = fileName;
 
@@ -62,10 +91,75 @@ PluginLogWriter::PluginLogWriter(const char* fileName, size_t maxSize) :
 
 	checkMutex("init", ISC_mutex_init(&m_mutex, mutexName.c_str()));
 #endif
+
+	if (m_bufferSize)
+	{
+		m_buffer.grow(m_bufferSize);
+		m_buffer.shrink(0);
+		m_flushBuffer.grow(m_bufferSize);
+		m_flushBuffer.shrink(0);
+
+		Thread::start(flushThread, this, THREAD_medium, &m_flushThread);
+	}
+}
+
+PluginLogWriter* PluginLogWriter::create(const char* fileName, size_t maxSize, size_t bufferSize)
+{
+	if (!bufferSize)
+	{
+		PluginLogWriter* const writer = FB_NEW PluginLogWriter(fileName, maxSize);
+		writer->addRef();
+		return writer;
+	}
+
+	// The first plugin instance opening the file defines its size limit and buffer size
+	MutexLockGuard guard(sharedWriters->mutex, FB_FUNCTION);
+
+	PluginLogWriter* writer;
+	if (!sharedWriters->writers.get(fileName, writer))
+	{
+		writer = FB_NEW PluginLogWriter(fileName, maxSize, bufferSize);
+		sharedWriters->writers.put(fileName, writer);
+	}
+
+	writer->addRef();
+	return writer;
+}
+
+int PluginLogWriter::release()
+{
+	if (!m_bufferSize)
+	{
+		if (--refCounter == 0)
+		{
+			delete this;
+			return 0;
+		}
+		return 1;
+	}
+
+	{	// scope
+		MutexLockGuard guard(sharedWriters->mutex, FB_FUNCTION);
+
+		if (--refCounter != 0)
+			return 1;
+
+		sharedWriters->writers.remove(m_fileName);
+	}
+
+	delete this;
+	return 0;
 }
 
 PluginLogWriter::~PluginLogWriter()
 {
+	if (m_bufferSize)
+	{
+		m_shutdown = true;
+		m_flushSem.release();
+		Thread::waitForCompletion(m_flushThread);
+	}
+
 	if (m_fileHandle != -1)
 		::close(m_fileHandle);
 
@@ -113,6 +207,84 @@ void PluginLogWriter::reopen()
 }
 
 FB_SIZE_T PluginLogWriter::write(const void* buf, FB_SIZE_T size)
+{
+	if (!m_bufferSize)
+		return writeFile(buf, size);
+
+	{	// scope
+		MutexLockGuard guard(m_bufferMutex, FB_FUNCTION);
+
+		if (m_buffer.getCount() + size <= m_bufferSize)
+		{
+			m_buffer.add(static_cast<const char*>(buf), size);
+
+			if (m_buffer.getCount() > m_bufferSize / 2)
+				m_flushSem.release();
+
+			return size;
+		}
+	}
+
+	// No room in the buffer: write the buffered records and then
+	// this one, so the file keeps the order they were logged in
+
+	MutexLockGuard guard(m_fileMutex, FB_FUNCTION);
+
+	flushBuffer();
+	return writeFile(buf, size);
+}
+
+THREAD_ENTRY_DECLARE PluginLogWriter::flushThread(THREAD_ENTRY_PARAM arg)
+{
+	PluginLogWriter* const log = static_cast<PluginLogWriter*>(arg);
+
+	while (!log->m_shutdown)
+	{
+		log->m_flushSem.tryEnter(0, FLUSH_INTERVAL);
+
+		try
+		{
+			MutexLockGuard guard(log->m_fileMutex, FB_FUNCTION);
+			log->flushBuffer();
+		}
+		catch (const Exception& ex)
+		{
+			iscLogException("PluginLogWriter: error writing trace log", ex);
+		}
+	}
+
+	try
+	{
+		MutexLockGuard guard(log->m_fileMutex, FB_FUNCTION);
+		log->flushBuffer();
+	}
+	catch (const Exception&)
+	{} // no-op
+
+	return 0;
+}
+
+void PluginLogWriter::flushBuffer()
+{
+	// Copy the buffered records away and write them outside of the buffer
+	// mutex, so the writers are not blocked by the file I/O.
+	// Caller holds m_fileMutex.
+
+	Array<char>& data = m_flushBuffer;
+	{	// scope
+		MutexLockGuard guard(m_bufferMutex, FB_FUNCTION);
+
+		if (m_buffer.isEmpty())
+			return;
+
+		data.assign(m_buffer);
+		m_buffer.shrink(0);
+	}
+
+	writeFile(data.begin(), data.getCount());
+}
+
+FB_SIZE_T PluginLogWriter::writeFile(const void* buf, FB_SIZE_T size)
 {
 #ifdef WIN_NT
 	Guard guard(this);
@@ -36,6 +36,10 @@
 #include "../../common/os/os_utils.h"
 #include "../../common/os/path_utils.h"
 #include "../../common/classes/ImplementHelper.h"
+#include "../../common/classes/array.h"
+#include "../../common/classes/locks.h"
+#include "../../common/classes/semaphore.h"
+#include "../../common/ThreadStart.h"
 
 #ifdef HAVE_UNISTD_H
 #include <unistd.h>
@@ -52,23 +56,20 @@ class PluginLogWriter FB_FINAL :
 	public Firebird::RefCntIface<Firebird::ITraceLogWriterImpl<PluginLogWriter, Firebird::CheckStatusWrapper> >
 {
 public:
-	PluginLogWriter(const char* fileName, size_t maxSize);
+	PluginLogWriter(const char* fileName, size_t maxSize, size_t bufferSize = 0);
 	~PluginLogWriter();
 
+	// Returns referenced writer. Buffered writers are shared by all plugin
+	// instances logging into the same file.
+	static PluginLogWriter* create(const char* fileName, size_t maxSize, size_t bufferSize);
+
 	// TraceLogWriter implementation
 	virtual FB_SIZE_T write(const void* buf, FB_SIZE_T size);
 
-	virtual int release()
-	{
-		if (--refCounter == 0)
-		{
-			delete this;
-			return 0;
-		}
-		return 1;
-	}
+	virtual int release();
 
 private:
+	FB_SIZE_T writeFile(const void* buf, FB_SIZE_T size);
 	SINT64 seekToEnd();
 	void reopen();
 	void checkErrno(const char* operation);
@@ -102,9 +103,25 @@ private:
 	};
 #endif
 
+	// When buffer size is set, records are appended to the in-memory buffer and
+	// written to the file by the background thread. Caller waits for the file
+	// I/O only when its record doesn't fit into the buffer: then the buffer and
+	// the record are written synchronously.
+	static THREAD_ENTRY_DECLARE flushThread(THREAD_ENTRY_PARAM arg);
+	void flushBuffer();
+
 	Firebird::PathName m_fileName;
 	int		 m_fileHandle;
 	size_t	 m_maxSize;
+
+	size_t	 m_bufferSize;
+	Firebird::Array<char> m_buffer;
+	Firebird::Array<char> m_flushBuffer;
+	Firebird::Mutex m_bufferMutex;		// protects m_buffer
+	Firebird::Mutex m_fileMutex;		// serializes flushes and file writes
+	Firebird::Semaphore m_flushSem;
+	Thread::Handle m_flushThread;
+	bool	 m_shutdown;
 };
 
 #endif // PLUGINLOGWRITER_H
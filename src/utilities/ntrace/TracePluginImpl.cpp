@@ -116,8 +116,8 @@ TracePluginImpl::TracePluginImpl(IPluginBase* plugin,
 		}
 		logFullName.appendPath(logname);
 
-		logWriter = FB_NEW PluginLogWriter(logFullName.c_str(), config.max_log_size * 1024 * 1024);
-		logWriter->addRef();
+		logWriter = PluginLogWriter::create(logFullName.c_str(), config.max_log_size * 1024 * 1024,
+			config.log_buffer_size * 1024);
 	}
 
 	Jrd::TextType* textType = unicodeCollation.getTextType();
@@ -38,6 +38,7 @@ PATH_PARAMETER(log_filename, "")
 BOOL_PARAMETER(log_errors, false)
 BOOL_PARAMETER(enabled, false)
 UINT_PARAMETER(max_log_size, 0)
+UINT_PARAMETER(log_buffer_size, 0)
 
 #ifdef DATABASE_PARAMS
 BOOL_PARAMETER(log_connections, false)